@@ -0,0 +1,285 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_ASYNC_HPP_INCLUDED
+#define CATCH_ASYNC_HPP_INCLUDED
+
+#include "../catch_user_config.hpp"  // Adjust to relative path (@wolfram77)
+
+// Like the other benchmark code using threads, async benchmarks need
+// `CATCH_CONFIG_USE_ASYNC`
+#if defined( CATCH_CONFIG_USE_ASYNC )
+
+#include "catch_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+
+#if defined( CATCH_CPP20_OR_GREATER ) && defined( __cpp_impl_coroutine )
+#    if __has_include( <coroutine> )
+#        define CATCH_INTERNAL_BENCHMARK_HAS_COROUTINES
+#        include <coroutine>
+#    endif
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        class AsyncLoop;
+
+        //! Completes the current iteration of an async benchmark. Call it
+        //! once per iteration, from any thread.
+        class Completion {
+        public:
+            explicit Completion( AsyncLoop& loop ): m_loop( &loop ) {}
+
+            void operator()() const;
+            //! Completes the iteration with the exception, which fails
+            //! the benchmark
+            void fail( std::exception_ptr exception ) const;
+
+        private:
+            AsyncLoop* m_loop;
+        };
+
+        /**
+         * Event loop driving the iterations of an async benchmark on the
+         * benchmarking thread
+         *
+         * Tasks are run one at a time until the iteration completes. While
+         * there are none, the loop waits for tasks or the completion from
+         * other threads, e.g. ones handling I/O.
+         */
+        class AsyncLoop {
+        public:
+            AsyncLoop() = default;
+            AsyncLoop( AsyncLoop const& ) = delete;
+            AsyncLoop& operator=( AsyncLoop const& ) = delete;
+
+            //! Queues the task to run on the loop, callable from any thread
+            void post( std::function<void()> task );
+
+            Completion completion() { return Completion( *this ); }
+
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_COROUTINES )
+            struct ScheduleAwaiter {
+                AsyncLoop* loop;
+
+                bool await_ready() const noexcept { return false; }
+                void await_suspend( std::coroutine_handle<> handle ) const {
+                    loop->post( [handle] { handle.resume(); } );
+                }
+                void await_resume() const noexcept {}
+            };
+            //! Awaitable resuming the awaiting coroutine from the loop
+            ScheduleAwaiter schedule() { return { this }; }
+#endif
+
+            // Used by `Chronometer::measureAsync`
+
+            void startIteration();
+            //! Runs tasks until the iteration completes, returns how many
+            //! ran. Rethrows the exception the iteration failed with.
+            std::uint64_t runUntilComplete();
+            //! Runs the queued tasks without waiting for more
+            void runPending();
+
+        private:
+            friend class Completion;
+            void complete( std::exception_ptr failure );
+
+            std::mutex m_mutex;
+            std::condition_variable m_wakeUp;
+            std::deque<std::function<void()>> m_tasks;
+            bool m_completed = false;
+            std::exception_ptr m_failure;
+        };
+
+        namespace Detail {
+            //! Time the loop itself takes, subtracted from async benchmarks
+            struct AsyncLoopCost {
+                //! Starting and completing an iteration
+                FDuration perIteration;
+                //! Posting and running a task
+                FDuration perTask;
+            };
+
+            //! Measured once, by the first call. The cost is the same
+            //! whichever clock the benchmarks are timed with.
+            AsyncLoopCost const& asyncLoopCost();
+
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_COROUTINES )
+            //! Coroutine running eagerly and destroying itself at the end
+            struct AsyncTask {
+                struct promise_type {
+                    AsyncTask get_return_object() noexcept { return {}; }
+                    std::suspend_never initial_suspend() noexcept { return {}; }
+                    std::suspend_never final_suspend() noexcept { return {}; }
+                    void return_void() noexcept {}
+                    // `driveAsync` catches everything
+                    void unhandled_exception() noexcept { std::terminate(); }
+                };
+            };
+
+            //! Completes the iteration once the awaitable does
+            template <typename Awaitable>
+            AsyncTask driveAsync( Awaitable awaitable, Completion done ) {
+                std::exception_ptr failure;
+                CATCH_TRY {
+                    co_await CATCH_MOVE( awaitable );
+                } CATCH_CATCH_ALL {
+                    failure = std::current_exception();
+                }
+                if ( failure ) {
+                    done.fail( failure );
+                } else {
+                    done();
+                }
+            }
+#endif
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_CONFIG_USE_ASYNC
+
+#endif // CATCH_ASYNC_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_async.cpp (@wolfram77)
+#ifndef CATCH_ASYNC_CPP_INCLUDED
+#define CATCH_ASYNC_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_async.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace {
+            // Enough iterations for the steady clock to resolve the cost,
+            // the fastest round is the one least disturbed by the system
+            constexpr int asyncCostIterations = 10000;
+            constexpr int asyncCostRounds = 5;
+
+            FDuration timeIterations( AsyncLoop& loop, bool postTask ) {
+                using steady = std::chrono::steady_clock;
+                auto fastest = FDuration( std::numeric_limits<double>::max() );
+                for ( int round = 0; round < asyncCostRounds; ++round ) {
+                    const auto start = steady::now();
+                    for ( int i = 0; i < asyncCostIterations; ++i ) {
+                        loop.startIteration();
+                        auto done = loop.completion();
+                        if ( postTask ) {
+                            loop.post( [done] { done(); } );
+                        } else {
+                            done();
+                        }
+                        loop.runUntilComplete();
+                    }
+                    const FDuration elapsed = steady::now() - start;
+                    fastest = (std::min)( fastest, elapsed / asyncCostIterations );
+                }
+                return fastest;
+            }
+        } // end unnamed namespace
+
+        void Completion::operator()() const { m_loop->complete( nullptr ); }
+
+        void Completion::fail( std::exception_ptr exception ) const {
+            m_loop->complete( CATCH_MOVE( exception ) );
+        }
+
+        void AsyncLoop::post( std::function<void()> task ) {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_tasks.push_back( CATCH_MOVE( task ) );
+            m_wakeUp.notify_one();
+        }
+
+        void AsyncLoop::startIteration() {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_completed = false;
+        }
+
+        std::uint64_t AsyncLoop::runUntilComplete() {
+            std::uint64_t ran = 0;
+            std::unique_lock<std::mutex> lock( m_mutex );
+            while ( !m_completed ) {
+                if ( m_tasks.empty() ) {
+                    m_wakeUp.wait( lock, [this] { return m_completed || !m_tasks.empty(); } );
+                    continue;
+                }
+                auto task = CATCH_MOVE( m_tasks.front() );
+                m_tasks.pop_front();
+                lock.unlock();
+                task();
+                ++ran;
+                lock.lock();
+            }
+            if ( m_failure ) {
+                auto failure = CATCH_MOVE( m_failure );
+                m_failure = nullptr;
+                std::rethrow_exception( failure );
+            }
+            return ran;
+        }
+
+        void AsyncLoop::runPending() {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            while ( !m_tasks.empty() ) {
+                auto task = CATCH_MOVE( m_tasks.front() );
+                m_tasks.pop_front();
+                lock.unlock();
+                task();
+                lock.lock();
+            }
+        }
+
+        void AsyncLoop::complete( std::exception_ptr failure ) {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_completed = true;
+            m_failure = CATCH_MOVE( failure );
+            // Notifying under the lock keeps the benchmarking thread from
+            // seeing the completion, and destroying the loop, before the
+            // notification is done
+            m_wakeUp.notify_one();
+        }
+
+        namespace Detail {
+            AsyncLoopCost const& asyncLoopCost() {
+                static const AsyncLoopCost cost = [] {
+                    AsyncLoop loop;
+                    const auto perIteration = timeIterations( loop, false );
+                    const auto withTask = timeIterations( loop, true );
+                    return AsyncLoopCost{ perIteration,
+                                          (std::max)( withTask - perIteration, FDuration::zero() ) };
+                }();
+                return cost;
+            }
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_CONFIG_USE_ASYNC
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_ASYNC_CPP_INCLUDED
+// END Amalgamated content from catch_async.cpp (@wolfram77)
@@ -14,79 +14,298 @@
 #include "../internal/catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_context.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_reusable_string_stream.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_source_line_info.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_test_failure_exception.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_unique_ptr.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_unique_name.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_capture.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_registry_hub.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_complexity.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_environment.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_execution_plan.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_estimate_clock.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_analyse.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_benchmark_family.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_function.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_benchmark_scheduler.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_latency_histogram.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_perf_counters.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_run_for_at_least.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_thread_team.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_tsc_clock.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <string>
 #include <cmath>
+#include <vector>
 
 namespace Catch {
     namespace Benchmark {
+        namespace Detail {
+            //! Selects the constructor of benchmarks that always run with
+            //! cold caches
+            struct ColdCacheTag {};
+
+            //! Benchmark between its prepare phase and its analysis, with
+            //! everything its samples are measured with
+            template <typename Clock>
+            class BenchmarkRun final : public ScheduledBenchmark {
+            public:
+                BenchmarkRun(IConfig const& cfg, Environment const& env, ExecutionPlan&& plan, BenchmarkInfo&& info, std::vector<std::string>&& warnings)
+                    : m_cfg(cfg), m_env(env), m_plan(CATCH_MOVE(plan)), m_info(CATCH_MOVE(info)), m_counters(cfg.benchmarkCounters()), m_warnings(CATCH_MOVE(warnings)) {
+                    if (!m_counters.warning().empty()) {
+                        m_warnings.push_back(m_counters.warning());
+                    }
+                    if (m_info.coldCache) {
+                        m_evictor = Catch::Detail::make_unique<CacheEvictor>();
+                    }
+                }
+
+                BenchmarkInfo const& info() const override { return m_info; }
+
+                bool sample() override {
+                    if (m_samples.empty()) {
+                        m_cpu = currentCpu();
+                        m_frequencyBefore = cpuFrequency(m_cpu);
+                        m_plan.template warmup<Clock>();
+                        m_samples.reserve(m_cfg.benchmarkSamples());
+                        m_laps = m_plan.reserve_laps(m_cfg, &m_iterationTimes);
+                        m_pauses = {};
+                    }
+                    m_samples.push_back(m_plan.template sample<Clock>(m_env, &m_counters, &m_allocations, m_evictor.get(), &m_userCounters, m_laps, &m_pauses));
+                    if (m_samples.size() < m_cfg.benchmarkSamples() &&
+                        !ExecutionPlan::precise_enough(m_cfg, m_running, m_samples.back())) {
+                        return true;
+                    }
+                    const double frequencyAfter = cpuFrequency(m_cpu);
+                    if (m_frequencyBefore > 0. && frequencyAfter > 0.) {
+                        m_frequencyDrift = frequencyAfter / m_frequencyBefore - 1.;
+                    }
+                    warnIfPausesDominate();
+                    return false;
+                }
+
+                //! Takes all samples at once. Samples taken while the CPU
+                //! frequency changed are not comparable to each other, so
+                //! they are retaken a few times before the drift is
+                //! reported with them. `BenchmarkScheduler` samples one at
+                //! a time instead, and does not retake them.
+                void sampleAll() {
+                    for (int attempt = 0;; ++attempt) {
+                        m_samples.clear();
+                        m_running = {};
+                        m_frequencyDrift = {};
+                        while (sample()) {}
+                        if (!m_frequencyDrift ||
+                            std::abs(*m_frequencyDrift) <= maximumFrequencyDrift ||
+                            attempt == frequencyDriftRetries) {
+                            break;
+                        }
+                    }
+                }
+
+                BenchmarkStats<> analyse() override {
+                    auto analysis = Detail::analyse(m_cfg, m_samples.data(), m_samples.data() + m_samples.size());
+                    BenchmarkStats<> stats{ m_info, CATCH_MOVE(analysis.samples), analysis.mean, analysis.standard_deviation, analysis.outliers, analysis.outlier_variance, m_allocations.perIteration(m_plan.iterations_per_sample), {}, {}, {}, m_frequencyDrift, {}, {}, {}, {}, {}, {}, {}, m_warnings };
+                    // Fewer samples are taken when the target precision is reached early
+                    stats.info.samples = static_cast<unsigned int>(stats.samples.size());
+                    auto perfCounters = m_counters.perIteration(m_plan.iterations_per_sample);
+                    stats.counters.insert(stats.counters.end(), perfCounters.begin(), perfCounters.end());
+                    m_userCounters.report(stats);
+                    // Tails are those of the iterations if they were timed
+                    // one by one, and of the sample means otherwise
+                    auto const& latencies = m_iterationTimes.empty() ? m_samples : m_iterationTimes;
+                    stats.percentiles = analyse_percentiles(m_cfg, latencies.data(), latencies.data() + latencies.size());
+                    if (m_cfg.benchmarkHistogram()) {
+                        LatencyHistogram histogram;
+                        for (auto const& latency : latencies) {
+                            histogram.record(latency);
+                        }
+                        stats.histogram = histogram.buckets();
+                    }
+                    if (!m_iterationTimes.empty()) {
+                        stats.maxIteration = *std::max_element(m_iterationTimes.begin(), m_iterationTimes.end());
+                        stats.iterationJitter = analyse_jitter(m_iterationTimes.data(), m_iterationTimes.data() + m_iterationTimes.size());
+                    }
+                    return stats;
+                }
+
+            private:
+                //! Reading the clock around every pause is subtracted by
+                //! its estimated cost, which must not be most of the time
+                void warnIfPausesDominate() {
+                    if (m_warnedAboutPauses || m_pauses.pauses == 0 ||
+                        m_env.clock_cost.mean * static_cast<double>(m_pauses.pauses) < m_pauses.timed) {
+                        return;
+                    }
+                    m_warnedAboutPauses = true;
+                    const double iterations = static_cast<double>(m_samples.size()) * m_plan.iterations_per_sample;
+                    ReusableStringStream rss;
+                    rss << "Benchmark '" << m_info.name << "' pauses "
+                        << static_cast<double>(m_pauses.pauses) / iterations
+                        << " times per iteration, reading the clock around the pauses takes longer than the timed code, "
+                           "so its times mostly depend on the estimated clock cost";
+                    m_warnings.push_back(rss.str());
+                }
+
+                IConfig const& m_cfg;
+                Environment m_env;
+                ExecutionPlan m_plan;
+                BenchmarkInfo m_info;
+                PerfCounterGroup m_counters;
+                //! Reported with the stats, after the benchmark
+                std::vector<std::string> m_warnings;
+                AllocationTracker m_allocations;
+                UserCounters m_userCounters;
+                Catch::Detail::unique_ptr<CacheEvictor> m_evictor;
+                std::vector<FDuration> m_samples;
+                std::vector<FDuration> m_iterationTimes;
+                std::vector<FDuration>* m_laps = nullptr;
+                running_mean m_running;
+                int m_cpu = -1;
+                double m_frequencyBefore = 0.;
+                Optional<double> m_frequencyDrift;
+                PauseStats m_pauses;
+                bool m_warnedAboutPauses = false;
+            };
+        } // namespace Detail
+
         struct Benchmark {
             Benchmark(std::string&& benchmarkName)
                 : name(CATCH_MOVE(benchmarkName)) {}
 
+            Benchmark(std::string&& benchmarkName, Detail::ColdCacheTag)
+                : name(CATCH_MOVE(benchmarkName)), coldCache(true) {}
+
             template <class FUN>
             Benchmark(std::string&& benchmarkName , FUN &&func)
                 : fun(CATCH_MOVE(func)), name(CATCH_MOVE(benchmarkName)) {}
 
+            //! Benchmark of a single point of the family
+            template <class FUN>
+            Benchmark(Detail::BenchmarkFamily& benchmarkFamily, std::uint64_t value, FUN &&func)
+                : fun(CATCH_MOVE(func)), name(benchmarkFamily.pointName(value)), family(&benchmarkFamily), parameterValue(value) {}
+
             template <typename Clock>
-            ExecutionPlan prepare(const IConfig &cfg, Environment env) {
+            ExecutionPlan prepare(const IConfig &cfg, Environment env, std::vector<std::string>& warnings) {
                 auto min_time = env.clock_resolution.mean * Detail::minimum_ticks;
                 auto run_time = std::max(min_time, std::chrono::duration_cast<decltype(min_time)>(cfg.benchmarkWarmupTime()));
                 auto&& test = Detail::run_for_at_least<Clock>(std::chrono::duration_cast<IDuration>(run_time), 1, fun);
                 int new_iters = static_cast<int>(std::ceil(min_time * test.iterations / test.elapsed));
-                return { new_iters, test.elapsed / test.iterations * new_iters * cfg.benchmarkSamples(), CATCH_MOVE(fun), std::chrono::duration_cast<FDuration>(cfg.benchmarkWarmupTime()), Detail::warmup_iterations };
+                // Shorter iterations would mostly measure the clock
+                const auto iteration_time = std::chrono::duration_cast<FDuration>(test.elapsed) / test.iterations;
+                const auto min_iteration_time = (std::max)(env.clock_resolution.mean, env.clock_cost.mean) * Detail::minimum_iteration_ticks;
+                if (isCold(cfg)) {
+                    // Every iteration needs its own eviction, and it must
+                    // not be timed, so iterations are timed one by one
+                    new_iters = 1;
+                    // They cannot be batched instead, so the results are
+                    // only flagged. The test run had warm caches, so a cold
+                    // iteration can take longer than this.
+                    if (iteration_time < min_iteration_time) {
+                        ReusableStringStream rss;
+                        rss << "Iterations of cold cache benchmark '" << name << "' take "
+                            << iteration_time.count() << " ns with warm caches, too close to the clock resolution to be timed one by one (minimum "
+                            << min_iteration_time.count() << " ns), so its times mostly measure the clock";
+                        warnings.push_back(rss.str());
+                    }
+                }
+                bool time_iterations = false;
+                if (cfg.benchmarkPerIteration()) {
+                    time_iterations = iteration_time >= min_iteration_time;
+                    // Cold cache iterations are timed one by one anyway,
+                    // and were warned about above
+                    if (!time_iterations && !isCold(cfg)) {
+                        ReusableStringStream rss;
+                        rss << "Iterations of benchmark '" << name << "' take "
+                            << iteration_time.count() << " ns, too close to the clock resolution to be timed one by one (minimum "
+                            << min_iteration_time.count() << " ns), so they are timed together";
+                        warnings.push_back(rss.str());
+                    }
+                }
+                return { new_iters, test.elapsed / test.iterations * new_iters * cfg.benchmarkSamples(), CATCH_MOVE(fun), std::chrono::duration_cast<FDuration>(cfg.benchmarkWarmupTime()), Detail::warmup_iterations, time_iterations };
             }
 
-            template <typename Clock = default_clock>
+            //! Runs with the clock selected by `IConfig::benchmarkClock`
+            void run() {
+                auto const* cfg = getCurrentContext().getConfig();
+                if (cfg->benchmarkClock() == BenchmarkClock::Tsc && Detail::tsc_clock::is_available()) {
+                    run<Detail::tsc_clock>();
+                } else {
+                    run<default_clock>();
+                }
+            }
+
+            template <typename Clock>
             void run() {
                 static_assert( Clock::is_steady,
                                "Benchmarking clock should be steady" );
                 auto const* cfg = getCurrentContext().getConfig();
 
+                // Interleaved benchmarks are sampled later, by the scheduler,
+                // which takes the lock again
+                Detail::BenchmarkLock lock;
+                // Pinned before calibration, which should run on the same CPU,
+                // and unpinned again once the benchmark is done
+                Catch::Detail::unique_ptr<Detail::ScopedCpuPin> pin;
+                if (cfg->benchmarkCpu() >= 0) {
+                    pin = Catch::Detail::make_unique<Detail::ScopedCpuPin>(cfg->benchmarkCpu());
+                }
                 auto env = Detail::measure_environment<Clock>();
 
-                getResultCapture().benchmarkPreparing(name);
+                // Points of a family are measured in order, the family
+                // compares every point to the previous ones
+                auto* scheduler = family ? nullptr : Detail::BenchmarkScheduler::active();
+                if (!scheduler) {
+                    getResultCapture().benchmarkPreparing(name);
+                }
                 CATCH_TRY{
+                    std::vector<std::string> warnings;
                     auto plan = user_code([&] {
-                        return prepare<Clock>(*cfg, env);
+                        return prepare<Clock>(*cfg, env, warnings);
                     });
 
                     BenchmarkInfo info {
-                        CATCH_MOVE(name),
+                        name,
                         plan.estimated_duration.count(),
                         plan.iterations_per_sample,
                         cfg->benchmarkSamples(),
                         cfg->benchmarkResamples(),
                         env.clock_resolution.mean.count(),
-                        env.clock_cost.mean.count()
+                        env.clock_cost.mean.count(),
+                        family ? family->name() : std::string(),
+                        family ? family->parameter() : std::string(),
+                        parameterValue,
+                        isCold(*cfg),
+                        Detail::readCpuState(Detail::currentCpu(), cfg->benchmarkCpu() >= 0)
                     };
 
-                    getResultCapture().benchmarkStarting(info);
+                    auto benchmarkRun = Catch::Detail::make_unique<Detail::BenchmarkRun<Clock>>(*cfg, env, CATCH_MOVE(plan), CATCH_MOVE(info), CATCH_MOVE(warnings));
+                    if (scheduler) {
+                        scheduler->add(CATCH_MOVE(benchmarkRun));
+                        return;
+                    }
 
-                    auto samples = user_code([&] {
-                        return plan.template run<Clock>(*cfg, env);
-                    });
-
-                    auto analysis = Detail::analyse(*cfg, samples.data(), samples.data() + samples.size());
-                    BenchmarkStats<> stats{ CATCH_MOVE(info), CATCH_MOVE(analysis.samples), analysis.mean, analysis.standard_deviation, analysis.outliers, analysis.outlier_variance };
+                    getResultCapture().benchmarkStarting(benchmarkRun->info());
+                    benchmarkRun->sampleAll();
+                    auto stats = benchmarkRun->analyse();
+                    if (family) {
+                        family->pointMeasured(stats);
+                    }
                     getResultCapture().benchmarkEnded(stats);
                 } CATCH_CATCH_ALL {
+                    if (scheduler) {
+                        getResultCapture().benchmarkPreparing(name);
+                    }
                     getResultCapture().benchmarkFailed(translateActiveException());
                     // We let the exception go further up so that the
                     // test case is marked as failed.
@@ -110,8 +329,150 @@ namespace Catch {
             }
 
         private:
+            bool isCold(IConfig const& cfg) const {
+                return coldCache || cfg.benchmarkColdCache();
+            }
+
             Detail::BenchmarkFunction fun;
             std::string name;
+            Detail::BenchmarkFamily* family = nullptr;
+            std::uint64_t parameterValue = 0;
+            bool coldCache = false;
+        };
+
+        /**
+         * Benchmark run by each of the given numbers of threads concurrently
+         *
+         * Every thread count is measured as a separate point of a
+         * `Detail::ThreadScalingFamily`. The benchmarked function can take
+         * the index of the thread running it, from 0 to thread count - 1.
+         *
+         * The single thread point runs first, as the reference of scaling
+         * efficiency, even if 1 is not among the given thread counts.
+         */
+        struct ThreadedBenchmark {
+            ThreadedBenchmark(std::string&& benchmarkName, std::vector<int> threadCounts)
+                : name(CATCH_MOVE(benchmarkName)), threads(CATCH_MOVE(threadCounts)) {}
+
+            // sets lambda to be run by the threads *and* executes benchmark!
+            template <typename Fun>
+            ThreadedBenchmark & operator=(Fun func) {
+                auto const* cfg = getCurrentContext().getConfig();
+                if (cfg->skipBenchmarks()) {
+                    return *this;
+                }
+                Detail::ThreadScalingFamily family(CATCH_MOVE(name));
+                Detail::ThreadTeamBodyModel<Fun> body(CATCH_MOVE(func));
+                std::vector<int> threadCounts{ 1 };
+                for (const int threadCount : threads) {
+                    if (threadCount != 1) {
+                        threadCounts.push_back(threadCount);
+                    }
+                }
+                for (const int threadCount : threadCounts) {
+                    // Threads are started lazily, so that failing to start
+                    // them is reported as a failure of the benchmark
+                    Catch::Detail::unique_ptr<Detail::ThreadTeam> team;
+                    Benchmark point(family, static_cast<std::uint64_t>(threadCount), [&](Chronometer meter) {
+                        if (!team) {
+                            team = Catch::Detail::make_unique<Detail::ThreadTeam>(threadCount, body);
+                        }
+                        team->measure(meter);
+                    });
+                    point.run();
+                }
+                return *this;
+            }
+
+            explicit operator bool() {
+                return true;
+            }
+
+        private:
+            std::string name;
+            std::vector<int> threads;
+        };
+
+        /**
+         * Benchmark run for each of the given values of `n`, e.g. input sizes
+         *
+         * Every value is measured as a separate point of a
+         * `Detail::ComplexityFamily`. The benchmarked function either takes
+         * `n` and is measured as a whole, or takes `Chronometer` and `n`
+         * and measures the relevant part itself, like `BENCHMARK_ADVANCED`.
+         *
+         * If the expected complexity is given, the test fails when the
+         * complexity fitted to the means is worse.
+         */
+        struct ParametricBenchmark {
+            ParametricBenchmark(SourceLineInfo const& lineInfo, std::string&& benchmarkName, std::vector<std::uint64_t> values)
+                : location(lineInfo), name(CATCH_MOVE(benchmarkName)), parameterValues(CATCH_MOVE(values)) {}
+            ParametricBenchmark(SourceLineInfo const& lineInfo, std::string&& benchmarkName, std::vector<std::uint64_t> values, Complexity expectedComplexity)
+                : location(lineInfo), name(CATCH_MOVE(benchmarkName)), parameterValues(CATCH_MOVE(values)), expected(expectedComplexity) {}
+
+            // sets lambda to be used for every value *and* executes benchmark!
+            template <typename Fun>
+            ParametricBenchmark & operator=(Fun func) {
+                auto const* cfg = getCurrentContext().getConfig();
+                if (cfg->skipBenchmarks()) {
+                    return *this;
+                }
+                Detail::ComplexityFamily family(CATCH_MOVE(name), parameterValues.size());
+                for (const auto value : parameterValues) {
+                    Benchmark point(family, value, [&func, value](Chronometer meter) {
+                        measurePoint(func, meter, value, is_callable<Fun&(Chronometer, std::uint64_t)>());
+                    });
+                    point.run();
+                }
+                if (expected) {
+                    family.checkComplexity(*expected, location);
+                }
+                return *this;
+            }
+
+            explicit operator bool() {
+                return true;
+            }
+
+        private:
+            template <typename Fun>
+            static void measurePoint(Fun& func, Chronometer meter, std::uint64_t value, std::true_type) {
+                func(meter, value);
+            }
+            template <typename Fun>
+            static void measurePoint(Fun& func, Chronometer meter, std::uint64_t value, std::false_type) {
+                meter.measure([&func, value] { return func(value); });
+            }
+
+            SourceLineInfo location;
+            std::string name;
+            std::vector<std::uint64_t> parameterValues;
+            Optional<Complexity> expected;
+        };
+
+        /**
+         * Benchmarks sampled in randomized round-robin order, so that slow
+         * drift of the machine affects all of them alike
+         *
+         * The benchmarks declared in the body are prepared right away,
+         * and sampled and reported once the body returns, see
+         * `Detail::BenchmarkScheduler`. They may only use variables
+         * declared outside of the body, which are still alive then.
+         * Benchmark families in the body are measured right away.
+         */
+        struct InterleavedBenchmarks {
+            // runs the lambda declaring the benchmarks *and* executes them!
+            template <typename Fun>
+            InterleavedBenchmarks & operator=(Fun func) {
+                Detail::BenchmarkScheduler scheduler;
+                func();
+                scheduler.run();
+                return *this;
+            }
+
+            explicit operator bool() {
+                return true;
+            }
         };
     }
 } // namespace Catch
@@ -127,12 +488,42 @@ namespace Catch {
     if( Catch::Benchmark::Benchmark BenchmarkName{name} ) \
         BenchmarkName = [&]
 
+#define INTERNAL_CATCH_BENCHMARK_COLD(BenchmarkName, name, benchmarkIndex)\
+    if( Catch::Benchmark::Benchmark BenchmarkName{name, Catch::Benchmark::Detail::ColdCacheTag{}} ) \
+        BenchmarkName = [&](int benchmarkIndex)
+
+#define INTERNAL_CATCH_BENCHMARK_ADVANCED_COLD(BenchmarkName, name)\
+    if( Catch::Benchmark::Benchmark BenchmarkName{name, Catch::Benchmark::Detail::ColdCacheTag{}} ) \
+        BenchmarkName = [&]
+
+#define INTERNAL_CATCH_BENCHMARK_THREADS(BenchmarkName, name, ...)\
+    if( Catch::Benchmark::ThreadedBenchmark BenchmarkName{name, __VA_ARGS__} ) \
+        BenchmarkName = [&]
+
+#define INTERNAL_CATCH_BENCHMARK_FAMILY(BenchmarkName, name, ...)\
+    if( Catch::Benchmark::ParametricBenchmark BenchmarkName{CATCH_INTERNAL_LINEINFO, name, __VA_ARGS__} ) \
+        BenchmarkName = [&]
+
+#define INTERNAL_CATCH_BENCHMARK_INTERLEAVED(BenchmarkName)\
+    if( Catch::Benchmark::InterleavedBenchmarks BenchmarkName{} ) \
+        BenchmarkName = [&]
+
 #if defined(CATCH_CONFIG_PREFIX_ALL)
 
 #define CATCH_BENCHMARK(...) \
     INTERNAL_CATCH_BENCHMARK(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), INTERNAL_CATCH_GET_1_ARG(__VA_ARGS__,,), INTERNAL_CATCH_GET_2_ARG(__VA_ARGS__,,))
 #define CATCH_BENCHMARK_ADVANCED(name) \
     INTERNAL_CATCH_BENCHMARK_ADVANCED(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name)
+#define CATCH_BENCHMARK_COLD(...) \
+    INTERNAL_CATCH_BENCHMARK_COLD(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), INTERNAL_CATCH_GET_1_ARG(__VA_ARGS__,,), INTERNAL_CATCH_GET_2_ARG(__VA_ARGS__,,))
+#define CATCH_BENCHMARK_ADVANCED_COLD(name) \
+    INTERNAL_CATCH_BENCHMARK_ADVANCED_COLD(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name)
+#define CATCH_BENCHMARK_THREADS(name, ...) \
+    INTERNAL_CATCH_BENCHMARK_THREADS(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name, __VA_ARGS__)
+#define CATCH_BENCHMARK_FAMILY(name, ...) \
+    INTERNAL_CATCH_BENCHMARK_FAMILY(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name, __VA_ARGS__)
+#define CATCH_BENCHMARK_INTERLEAVED() \
+    INTERNAL_CATCH_BENCHMARK_INTERLEAVED(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_))
 
 #else
 
@@ -140,6 +531,16 @@ namespace Catch {
     INTERNAL_CATCH_BENCHMARK(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), INTERNAL_CATCH_GET_1_ARG(__VA_ARGS__,,), INTERNAL_CATCH_GET_2_ARG(__VA_ARGS__,,))
 #define BENCHMARK_ADVANCED(name) \
     INTERNAL_CATCH_BENCHMARK_ADVANCED(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name)
+#define BENCHMARK_COLD(...) \
+    INTERNAL_CATCH_BENCHMARK_COLD(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), INTERNAL_CATCH_GET_1_ARG(__VA_ARGS__,,), INTERNAL_CATCH_GET_2_ARG(__VA_ARGS__,,))
+#define BENCHMARK_ADVANCED_COLD(name) \
+    INTERNAL_CATCH_BENCHMARK_ADVANCED_COLD(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name)
+#define BENCHMARK_THREADS(name, ...) \
+    INTERNAL_CATCH_BENCHMARK_THREADS(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name, __VA_ARGS__)
+#define BENCHMARK_FAMILY(name, ...) \
+    INTERNAL_CATCH_BENCHMARK_FAMILY(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_), name, __VA_ARGS__)
+#define BENCHMARK_INTERLEAVED() \
+    INTERNAL_CATCH_BENCHMARK_INTERLEAVED(INTERNAL_CATCH_UNIQUE_NAME(CATCH2_INTERNAL_BENCHMARK_))
 
 #endif
 
@@ -21,9 +21,11 @@
 #ifndef CATCH_BENCHMARK_ALL_HPP_INCLUDED
 #define CATCH_BENCHMARK_ALL_HPP_INCLUDED
 
+#include "catch_async.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_benchmark.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_chronometer.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_complexity.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_constructor.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_environment.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_estimate.hpp"  // Adjust to relative path (@wolfram77)
@@ -31,16 +33,28 @@
 #include "catch_optimizer.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_outlier_classification.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_sample_analysis.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_allocation_tracker.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_analyse.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_benchmark_baseline.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_benchmark_family.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_function.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_benchmark_scheduler.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_stats_fwd.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_cache_evictor.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_complete_invoke.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_environment_cache.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_estimate_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_latency_histogram.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_measure.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_perf_counters.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_repeat.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_run_for_at_least.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_thread_team.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_timing.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_tsc_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 
 #endif // CATCH_BENCHMARK_ALL_HPP_INCLUDED
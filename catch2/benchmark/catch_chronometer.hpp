@@ -9,17 +9,42 @@
 #ifndef CATCH_CHRONOMETER_HPP_INCLUDED
 #define CATCH_CHRONOMETER_HPP_INCLUDED
 
+#include "../catch_user_config.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_clock.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_optimizer.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_allocation_tracker.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_cache_evictor.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_perf_counters.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_meta.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+#    include "catch_async.hpp"  // Adjust to relative path (@wolfram77)
+#endif
+
 namespace Catch {
     namespace Benchmark {
         namespace Detail {
             struct ChronometerConcept {
                 virtual void start() = 0;
                 virtual void finish() = 0;
+                //! Should `lap` be called after every iteration?
+                virtual bool timesIterations() const { return false; }
+                //! Ends the timing of an iteration and starts the next one
+                virtual void lap() {}
+                //! Stops the clock until `resume`, between `start` and `finish`
+                virtual void pause() {}
+                virtual void resume() {}
+                //! Subtracts time known to be overhead from the timing
+                virtual void exclude(FDuration) {}
                 virtual ~ChronometerConcept(); // = default;
 
                 ChronometerConcept() = default;
@@ -28,19 +53,119 @@ namespace Catch {
             };
             template <typename Clock>
             struct ChronometerModel final : public ChronometerConcept {
-                void start() override { started = Clock::now(); }
-                void finish() override { finished = Clock::now(); }
+                void start() override {
+                    if ( evictor ) { evictor->evict(); }
+                    if ( counters ) { counters->start(); }
+                    if ( allocations ) { allocations->start(); }
+                    running = true;
+                    started = Clock::now();
+                    lapStarted = started;
+                }
+                bool timesIterations() const override { return laps != nullptr; }
+                void lap() override {
+                    const auto now = Clock::now();
+                    laps->push_back( now - lapStarted - lapPaused - pauseCost * lapPauses );
+                    lapStarted = now;
+                    lapPaused = FDuration::zero();
+                    lapPauses = 0;
+                }
+                void pause() override {
+                    if ( !running || paused ) { return; }
+                    paused = true;
+                    pausedAt = Clock::now();
+                    if ( allocations ) { allocations->pause(); }
+                    if ( counters ) { counters->pause(); }
+                }
+                void resume() override {
+                    if ( !paused ) { return; }
+                    if ( counters ) { counters->resume(); }
+                    if ( allocations ) { allocations->resume(); }
+                    const FDuration interval = Clock::now() - pausedAt;
+                    paused = false;
+                    pausedTime += interval;
+                    lapPaused += interval;
+                    ++pauses;
+                    ++lapPauses;
+                }
+                void exclude(FDuration overhead) override {
+                    pausedTime += overhead;
+                    lapPaused += overhead;
+                }
+                void finish() override {
+                    resume();
+                    finished = Clock::now();
+                    running = false;
+                    if ( allocations ) { allocations->stop(); }
+                    if ( counters ) { counters->stop(); }
+                }
 
                 IDuration elapsed() const {
                     return std::chrono::duration_cast<std::chrono::nanoseconds>(
                         finished - started );
                 }
+                //! Elapsed time without the pauses, and without `pauseCost`
+                //! for the clock reads of every pause that were still timed
+                FDuration timed() const {
+                    return elapsed() - pausedTime - pauseCost * pauses;
+                }
 
                 TimePoint<Clock> started;
                 TimePoint<Clock> finished;
+                TimePoint<Clock> lapStarted;
+                TimePoint<Clock> pausedAt;
+                bool running = false;
+                bool paused = false;
+                FDuration pausedTime = FDuration::zero();
+                FDuration lapPaused = FDuration::zero();
+                std::uint64_t pauses = 0;
+                std::uint64_t lapPauses = 0;
+                //! Cost of reading the clock, of which about one is timed
+                //! for every pause, the end of pausing and the start of
+                //! resuming
+                FDuration pauseCost = FDuration::zero();
+                //! Optional buffer every iteration is timed into, with
+                //! capacity reserved for all of them so that timing does
+                //! not allocate
+                std::vector<FDuration>* laps = nullptr;
+                //! Optional counters running alongside the clock
+                PerfCounterGroup* counters = nullptr;
+                //! Optional tracker of heap allocations in the timed region
+                AllocationTracker* allocations = nullptr;
+                //! Optional evictor flushing the caches before the clock starts
+                CacheEvictor* evictor = nullptr;
+            };
+
+            class ThreadTeam;
+
+            //! Default teardown of `Chronometer::measureBatched`, which
+            //! leaves the inputs to their destructors
+            struct DestroyInput {
+                template <typename Input>
+                void operator()(Input&) const {}
             };
+
+            //! Inputs of a batched benchmark made at once, at most
+            //! `iterations` and at least one
+            std::size_t batchSize(int iterations, std::size_t bytesPerInput);
         } // namespace Detail
 
+        //! Keeps the chronometer paused while it lives, see
+        //! `Chronometer::untimed`
+        class UntimedScope {
+        public:
+            explicit UntimedScope(Detail::ChronometerConcept& meter)
+                : impl(&meter) { impl->pause(); }
+            UntimedScope(UntimedScope&& other) noexcept
+                : impl(other.impl) { other.impl = nullptr; }
+            UntimedScope(UntimedScope const&) = delete;
+            UntimedScope& operator=(UntimedScope const&) = delete;
+            UntimedScope& operator=(UntimedScope&&) = delete;
+            ~UntimedScope() { if (impl) { impl->resume(); } }
+
+        private:
+            Detail::ChronometerConcept* impl;
+        };
+
         struct Chronometer {
         public:
             template <typename Fun>
@@ -48,11 +173,137 @@ namespace Catch {
 
             int runs() const { return repeats; }
 
-            Chronometer(Detail::ChronometerConcept& meter, int repeats_)
+            //! Stops the clock inside `measure` until `resume`, e.g. to
+            //! prepare the input of the next iteration. Reading the clock
+            //! around the pause is subtracted too, by its measured cost.
+            void pause() { impl->pause(); }
+            void resume() { impl->resume(); }
+            //! Pauses the clock until the returned scope ends
+            UntimedScope untimed() { return UntimedScope(*impl); }
+
+            /**
+             * Times `fun` on inputs made by `setup` outside of the timed
+             * region, e.g. to measure destructive operations like sorting
+             *
+             * `setup` makes an input, given the index of the iteration if
+             * it takes one. The inputs are made in batches, as many as fit
+             * into `IConfig::benchmarkBatchMemory` at `bytesPerInput` each
+             * (their size by default), and passed to `fun` as rvalues.
+             * After every batch, `teardown` gets each input before it is
+             * destroyed, both untimed.
+             */
+            template <typename Setup, typename Fun, typename Teardown = Detail::DestroyInput>
+            void measureBatched(Setup&& setup, Fun&& fun, Teardown&& teardown = Teardown(), std::size_t bytesPerInput = 0) {
+                using Input = std::decay_t<decltype(makeInput(setup, 0, is_callable<Setup(int)>()))>;
+                const auto batch = Detail::batchSize(repeats, bytesPerInput ? bytesPerInput : sizeof(Input));
+                std::vector<Input> inputs;
+                inputs.reserve(batch);
+                auto dropInputs = [&] {
+                    for (auto& input : inputs) { teardown(input); }
+                    inputs.clear();
+                };
+
+                Detail::optimizer_barrier();
+                const bool laps = impl->timesIterations();
+                impl->start();
+                for (int done = 0; done < repeats; done += static_cast<int>(inputs.size())) {
+                    impl->pause();
+                    dropInputs();
+                    const int count = (std::min)(static_cast<int>(batch), repeats - done);
+                    for (int i = 0; i < count; ++i) {
+                        inputs.push_back(makeInput(setup, done + i, is_callable<Setup(int)>()));
+                    }
+                    impl->resume();
+                    for (auto& input : inputs) {
+                        invoke_deoptimized([&]() -> decltype(auto) { return fun(CATCH_MOVE(input)); });
+                        if (laps) { impl->lap(); }
+                    }
+                }
+                impl->pause();
+                dropInputs();
+                impl->finish();
+                Detail::optimizer_barrier();
+            }
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+            /**
+             * Times `fun` from its call until it completes, rather than
+             * until it returns, e.g. to measure asynchronous I/O
+             *
+             * Needs `CATCH_CONFIG_USE_ASYNC`. `fun` gets an `AsyncLoop`, which runs the iterations one at
+             * a time and the tasks posted to it, and a `Completion` to call
+             * when the iteration is done. With C++20 coroutines, `fun` may
+             * instead take just the loop and return an awaitable, which
+             * completes the iteration when it does. The time the loop takes
+             * for every iteration and task, measured once, is subtracted.
+             */
+            template <typename Fun>
+            void measureAsync(Fun&& fun) {
+                auto const& cost = Detail::asyncLoopCost();
+                AsyncLoop loop;
+
+                Detail::optimizer_barrier();
+                const bool laps = impl->timesIterations();
+                impl->start();
+                for (int i = 0; i < repeats; ++i) {
+                    loop.startIteration();
+                    startAsync(fun, loop, is_callable<Fun&(AsyncLoop&, Completion)>());
+                    const auto tasks = loop.runUntilComplete();
+                    impl->exclude(cost.perIteration + cost.perTask * static_cast<double>(tasks));
+                    if (laps) { impl->lap(); }
+                }
+                impl->finish();
+                Detail::optimizer_barrier();
+                loop.runPending();
+            }
+#endif
+
+            //! Declares bytes processed by every iteration, which are
+            //! reported as throughput
+            void setBytesProcessed(std::uint64_t bytes) {
+                if (userCounters) { userCounters->setBytesProcessed(bytes); }
+            }
+            //! Declares items processed by every iteration, which are
+            //! reported as throughput
+            void setItemsProcessed(std::uint64_t items) {
+                if (userCounters) { userCounters->setItemsProcessed(items); }
+            }
+            //! Reports value of a named counter, aggregated according to
+            //! the mode. Report outside of `measure`, which would time it.
+            void counter(std::string const& name, double value, CounterMode mode = CounterMode::Sum) {
+                if (userCounters) { userCounters->add(name, value, mode); }
+            }
+
+            Chronometer(Detail::ChronometerConcept& meter, int repeats_, Detail::UserCounters* userCounters_ = nullptr)
                 : impl(&meter)
-                , repeats(repeats_) {}
+                , repeats(repeats_)
+                , userCounters(userCounters_) {}
 
         private:
+            // Times all of its threads with a single start and finish
+            friend class Detail::ThreadTeam;
+
+            template <typename Setup>
+            static decltype(auto) makeInput(Setup& setup, int index, std::true_type) { return setup(index); }
+            template <typename Setup>
+            static decltype(auto) makeInput(Setup& setup, int, std::false_type) { return setup(); }
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+            template <typename Fun>
+            static void startAsync(Fun& fun, AsyncLoop& loop, std::true_type) { fun(loop, loop.completion()); }
+            template <typename Fun>
+            static void startAsync(Fun& fun, AsyncLoop& loop, std::false_type) {
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_COROUTINES )
+                Detail::driveAsync(fun(loop), loop.completion());
+#else
+                static_assert(is_callable<Fun&(AsyncLoop&, Completion)>::value,
+                              "measureAsync needs a function taking the loop and a Completion, "
+                              "or C++20 coroutines for one returning an awaitable");
+                (void)fun; (void)loop;
+#endif
+            }
+#endif
+
             template <typename Fun>
             void measure(Fun&& fun, std::false_type) {
                 measure([&fun](int) { return fun(); }, std::true_type());
@@ -61,14 +312,22 @@ namespace Catch {
             template <typename Fun>
             void measure(Fun&& fun, std::true_type) {
                 Detail::optimizer_barrier();
+                const bool laps = impl->timesIterations();
                 impl->start();
-                for (int i = 0; i < repeats; ++i) invoke_deoptimized(fun, i);
+                if (laps) {
+                    for (int i = 0; i < repeats; ++i) { invoke_deoptimized(fun, i); impl->lap(); }
+                } else {
+                    for (int i = 0; i < repeats; ++i) invoke_deoptimized(fun, i);
+                }
                 impl->finish();
                 Detail::optimizer_barrier();
             }
 
             Detail::ChronometerConcept* impl;
             int repeats;
+            //! Null outside of the samples, e.g. when estimating, so that
+            //! only the sampled iterations are counted
+            Detail::UserCounters* userCounters;
         };
     } // namespace Benchmark
 } // namespace Catch
@@ -89,11 +348,25 @@ namespace Catch {
 // SPDX-License-Identifier: BSL-1.0
 
 // #include "catch_chronometer.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_context.hpp"  // Adjust to relative path (@wolfram77)
 
 namespace Catch {
     namespace Benchmark {
         namespace Detail {
             ChronometerConcept::~ChronometerConcept() = default;
+
+            std::size_t batchSize( int iterations, std::size_t bytesPerInput ) {
+                auto const* config = getCurrentContext().getConfig();
+                std::size_t batch = static_cast<std::size_t>( (std::max)( iterations, 1 ) );
+                if ( config && bytesPerInput > 0 ) {
+                    const auto fitting = config->benchmarkBatchMemory() / bytesPerInput;
+                    if ( fitting < batch ) {
+                        batch = (std::max)( static_cast<std::size_t>( fitting ), std::size_t( 1 ) );
+                    }
+                }
+                return batch;
+            }
         } // namespace Detail
     } // namespace Benchmark
 } // namespace Catch
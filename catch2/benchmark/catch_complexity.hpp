@@ -0,0 +1,175 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_COMPLEXITY_HPP_INCLUDED
+#define CATCH_COMPLEXITY_HPP_INCLUDED
+
+#include "../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+
+        //! Asymptotic complexities benchmark families are fitted against,
+        //! from the best to the worst
+        enum class Complexity {
+            Constant,
+            Logarithmic,
+            Linear,
+            Linearithmic,
+            Quadratic
+        };
+
+        //! Big-O notation of the complexity, e.g. "O(n log n)"
+        StringRef complexityName( Complexity complexity );
+
+        struct ComplexityFit {
+            Complexity complexity;
+            //! Time in nanoseconds is `coefficient * f(n)`, logarithms
+            //! are binary
+            double coefficient;
+            //! Root mean square error of the fit, relative to the mean time
+            double rms;
+        };
+
+        namespace Detail {
+            /**
+             * Least squares fit of `times[i] = coefficient * f(values[i])`
+             * for every known complexity `f`, returns the one with the
+             * lowest RMS error
+             *
+             * Needs at least two points.
+             */
+            ComplexityFit fitComplexity( std::vector<std::uint64_t> const& values,
+                                         std::vector<double> const& times );
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_COMPLEXITY_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_complexity.cpp (@wolfram77)
+#ifndef CATCH_COMPLEXITY_CPP_INCLUDED
+#define CATCH_COMPLEXITY_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_complexity.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace {
+            constexpr Complexity allComplexities[] = {
+                Complexity::Constant,     Complexity::Logarithmic,
+                Complexity::Linear,       Complexity::Linearithmic,
+                Complexity::Quadratic,
+            };
+
+            double complexityFunction( Complexity complexity, double n ) {
+                switch ( complexity ) {
+                case Complexity::Constant:
+                    return 1.;
+                case Complexity::Logarithmic:
+                    return std::log2( n );
+                case Complexity::Linear:
+                    return n;
+                case Complexity::Linearithmic:
+                    return n * std::log2( n );
+                case Complexity::Quadratic:
+                    return n * n;
+                }
+                CATCH_INTERNAL_ERROR( "Unknown complexity" );
+            }
+        } // end unnamed namespace
+
+        StringRef complexityName( Complexity complexity ) {
+            switch ( complexity ) {
+            case Complexity::Constant:
+                return "O(1)"_sr;
+            case Complexity::Logarithmic:
+                return "O(log n)"_sr;
+            case Complexity::Linear:
+                return "O(n)"_sr;
+            case Complexity::Linearithmic:
+                return "O(n log n)"_sr;
+            case Complexity::Quadratic:
+                return "O(n^2)"_sr;
+            }
+            CATCH_INTERNAL_ERROR( "Unknown complexity" );
+        }
+
+        namespace Detail {
+            ComplexityFit fitComplexity( std::vector<std::uint64_t> const& values,
+                                         std::vector<double> const& times ) {
+                assert( values.size() == times.size() && values.size() >= 2 );
+
+                double meanTime = 0.;
+                for ( const double time : times ) {
+                    meanTime += time;
+                }
+                meanTime /= static_cast<double>( times.size() );
+
+                ComplexityFit best{ Complexity::Constant,
+                                    0.,
+                                    std::numeric_limits<double>::infinity() };
+                for ( const auto complexity : allComplexities ) {
+                    // Minimizing sum of (t - c * f(n))^2 gives
+                    // c = sum(t * f(n)) / sum(f(n)^2)
+                    double timeDotF = 0.;
+                    double fSquared = 0.;
+                    for ( std::size_t i = 0; i < values.size(); ++i ) {
+                        const double f = complexityFunction(
+                            complexity, static_cast<double>( values[i] ) );
+                        timeDotF += times[i] * f;
+                        fSquared += f * f;
+                    }
+                    if ( !( fSquared > 0. ) || !std::isfinite( fSquared ) ) {
+                        // e.g. log n for n = 1 only, or n^2 overflowing
+                        continue;
+                    }
+                    const double coefficient = timeDotF / fSquared;
+
+                    double squaredError = 0.;
+                    for ( std::size_t i = 0; i < values.size(); ++i ) {
+                        const double residual =
+                            times[i] - coefficient * complexityFunction(
+                                                         complexity,
+                                                         static_cast<double>(
+                                                             values[i] ) );
+                        squaredError += residual * residual;
+                    }
+                    const double rms =
+                        std::sqrt( squaredError /
+                                   static_cast<double>( values.size() ) );
+                    // Ties go to the simpler complexity
+                    if ( rms < best.rms ) {
+                        best = { complexity, coefficient, rms };
+                    }
+                }
+                if ( meanTime > 0. ) {
+                    best.rms /= meanTime;
+                }
+                return best;
+            }
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_COMPLEXITY_CPP_INCLUDED
+// END Amalgamated content from catch_complexity.cpp (@wolfram77)
@@ -13,43 +13,114 @@
 #include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_clock.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_environment.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_allocation_tracker.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_benchmark_function.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_cache_evictor.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_perf_counters.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_repeat.hpp"  // Adjust to relative path (@wolfram77)
 #include "detail/catch_run_for_at_least.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 
 namespace Catch {
     namespace Benchmark {
+        namespace Detail {
+            //! Pauses of the chronometer over the samples of a benchmark
+            struct PauseStats {
+                std::uint64_t pauses = 0;
+                //! Time measured between the pauses
+                FDuration timed = FDuration::zero();
+            };
+        } // namespace Detail
+
         struct ExecutionPlan {
             int iterations_per_sample;
             FDuration estimated_duration;
             Detail::BenchmarkFunction benchmark;
             FDuration warmup_time;
             int warmup_iterations;
+            //! Is every iteration timed on its own? Only set when the
+            //! iterations are much longer than reading the clock takes
+            bool time_iterations = false;
 
+            //! Runs the clock for `warmup_time` to wake the CPU up
             template <typename Clock>
-            std::vector<FDuration> run(const IConfig &cfg, Environment env) const {
-                // warmup a bit
+            void warmup() const {
                 Detail::run_for_at_least<Clock>(
                     std::chrono::duration_cast<IDuration>( warmup_time ),
                     warmup_iterations,
                     Detail::repeat( []() { return Clock::now(); } )
                 );
+            }
 
-                std::vector<FDuration> times;
-                const auto num_samples = cfg.benchmarkSamples();
-                times.reserve( num_samples );
-                for ( size_t i = 0; i < num_samples; ++i ) {
-                    Detail::ChronometerModel<Clock> model;
-                    this->benchmark( Chronometer( model, iterations_per_sample ) );
-                    auto sample_time = model.elapsed() - env.clock_cost.mean;
-                    if ( sample_time < FDuration::zero() ) {
-                        sample_time = FDuration::zero();
+            //! Takes one sample, the mean time of its iterations. With
+            //! `laps`, every iteration is timed into it, without the
+            //! clock cost. Pauses of the chronometer are added to `pauses`.
+            template <typename Clock>
+            FDuration sample(Environment const& env, Detail::PerfCounterGroup* counters = nullptr, Detail::AllocationTracker* allocations = nullptr, Detail::CacheEvictor* evictor = nullptr, Detail::UserCounters* userCounters = nullptr, std::vector<FDuration>* laps = nullptr, Detail::PauseStats* pauses = nullptr) const {
+                Detail::ChronometerModel<Clock> model;
+                model.counters = counters;
+                model.allocations = allocations;
+                model.evictor = evictor;
+                model.laps = laps;
+                model.pauseCost = env.clock_cost.mean;
+                const size_t laps_before = laps ? laps->size() : 0;
+                this->benchmark( Chronometer( model, iterations_per_sample, userCounters ) );
+                if ( userCounters ) {
+                    userCounters->sampleTaken( iterations_per_sample );
+                }
+                if ( pauses ) {
+                    pauses->pauses += model.pauses;
+                    pauses->timed += model.timed();
+                }
+                if ( laps && laps->size() - laps_before == static_cast<size_t>( iterations_per_sample ) ) {
+                    // Every lap includes reading the clock once
+                    FDuration total = FDuration::zero();
+                    for ( size_t lap = laps_before; lap < laps->size(); ++lap ) {
+                        auto& iteration_time = ( *laps )[lap];
+                        iteration_time = (std::max)( iteration_time - env.clock_cost.mean, FDuration::zero() );
+                        total += iteration_time;
                     }
-                    times.push_back(sample_time / iterations_per_sample);
+                    return total / iterations_per_sample;
+                }
+                // Benchmarks timing themselves differently, e.g.
+                // threaded ones, or measuring several times
+                if ( laps ) {
+                    laps->resize( laps_before );
+                }
+                auto sample_time = model.timed() - env.clock_cost.mean;
+                if ( sample_time < FDuration::zero() ) {
+                    sample_time = FDuration::zero();
+                }
+                return sample_time / iterations_per_sample;
+            }
+
+            //! Buffer to time the iterations of all samples into, with
+            //! `time_iterations`, null otherwise. Reserved up front, so
+            //! that no iteration is timed with a reallocation.
+            std::vector<FDuration>* reserve_laps(const IConfig &cfg, std::vector<FDuration>* iterationTimes) const {
+                if ( !time_iterations || !iterationTimes ) {
+                    return nullptr;
+                }
+                iterationTimes->clear();
+                iterationTimes->reserve( cfg.benchmarkSamples() * static_cast<size_t>( iterations_per_sample ) );
+                return iterationTimes;
+            }
+
+            //! With target precision, the samples stop as soon as the
+            //! mean is known precisely enough
+            static bool precise_enough(const IConfig &cfg, Detail::running_mean& running, FDuration sample) {
+                const double target_precision = cfg.benchmarkTargetPrecision() / 100.;
+                if ( !( target_precision > 0 ) ) {
+                    return false;
                 }
-                return times;
+                running.add( sample.count() );
+                return running.count >= (std::min)( cfg.benchmarkMinSamples(), cfg.benchmarkSamples() ) &&
+                       running.relative_half_width( cfg.benchmarkConfidenceInterval() ) <= target_precision;
             }
         };
     } // namespace Benchmark
@@ -0,0 +1,239 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_ALLOCATION_TRACKER_HPP_INCLUDED
+#define CATCH_ALLOCATION_TRACKER_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../catch_user_config.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            struct AllocationCounts {
+                std::uint64_t allocations;
+                std::uint64_t frees;
+                std::uint64_t bytes;
+            };
+
+#if defined( CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS )
+            //! Used by the replaced global allocation functions, returns
+            //! null if there is not enough memory and no new handler
+            void* trackedAllocate( std::size_t size );
+            void trackedFree( void* ptr ) noexcept;
+#endif
+
+            //! Returns counts of heap allocations made by the calling thread
+            //! so far, always zero unless allocations are tracked
+            AllocationCounts threadAllocationCounts();
+
+            /**
+             * Counts heap allocations during the timed region of samples
+             *
+             * With `CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS` defined, the
+             * implementation replaces global `operator new` and `operator
+             * delete`, which then bump plain thread local counters. The
+             * counters are only read when the clock is not running, so the
+             * only cost inside the timed region is the increments in the
+             * allocation functions themselves.
+             *
+             * Only allocations of the thread running the sample are counted,
+             * and overaligned `operator new` is not replaced.
+             */
+            class AllocationTracker {
+            public:
+                void start() {
+                    if ( trackingEnabled ) {
+                        m_started = threadAllocationCounts();
+                    }
+                }
+                void stop() {
+                    pause();
+                    if ( trackingEnabled ) {
+                        ++m_intervals;
+                    }
+                }
+                //! Stops tracking until `resume`, within the same interval
+                void pause() {
+                    if ( trackingEnabled ) {
+                        const auto counts = threadAllocationCounts();
+                        m_total.allocations += counts.allocations - m_started.allocations;
+                        m_total.frees += counts.frees - m_started.frees;
+                        m_total.bytes += counts.bytes - m_started.bytes;
+                    }
+                }
+                void resume() { start(); }
+
+                //! Returns "allocations", "frees" and "allocated-bytes" per
+                //! iteration, empty if allocations are not tracked
+                std::vector<BenchmarkCounter>
+                perIteration( int iterationsPerInterval ) const;
+
+            private:
+#if defined( CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS )
+                static constexpr bool trackingEnabled = true;
+#else
+                static constexpr bool trackingEnabled = false;
+#endif
+                AllocationCounts m_started{};
+                AllocationCounts m_total{};
+                std::uint64_t m_intervals = 0;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_ALLOCATION_TRACKER_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_allocation_tracker.cpp (@wolfram77)
+#ifndef CATCH_ALLOCATION_TRACKER_CPP_INCLUDED
+#define CATCH_ALLOCATION_TRACKER_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_allocation_tracker.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS )
+#    include <cstdlib>
+#    include <new>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+#if defined( CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS )
+            namespace {
+                // Trivial type with constant initialization, so that
+                // accessing it needs no thread local initialization guard
+                thread_local AllocationCounts threadCounts{ 0, 0, 0 };
+            } // end unnamed namespace
+
+            void* trackedAllocate( std::size_t size ) {
+                if ( size == 0 ) {
+                    size = 1;
+                }
+                for ( ;; ) {
+                    if ( void* ptr = std::malloc( size ) ) {
+                        ++threadCounts.allocations;
+                        threadCounts.bytes += size;
+                        return ptr;
+                    }
+                    auto handler = std::get_new_handler();
+                    if ( !handler ) {
+                        return nullptr;
+                    }
+                    handler();
+                }
+            }
+
+            // GCC sees memory from operator new being freed with std::free
+            // when this gets inlined into delete expressions
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#    pragma GCC diagnostic push
+#    pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+            void trackedFree( void* ptr ) noexcept {
+                if ( ptr ) {
+                    ++threadCounts.frees;
+                    std::free( ptr );
+                }
+            }
+#if defined( __GNUC__ ) && !defined( __clang__ ) && __GNUC__ >= 11
+#    pragma GCC diagnostic pop
+#endif
+
+            AllocationCounts threadAllocationCounts() { return threadCounts; }
+#else
+            AllocationCounts threadAllocationCounts() { return { 0, 0, 0 }; }
+#endif
+
+            std::vector<BenchmarkCounter>
+            AllocationTracker::perIteration( int iterationsPerInterval ) const {
+                std::vector<BenchmarkCounter> result;
+                if ( m_intervals == 0 || iterationsPerInterval <= 0 ) {
+                    return result;
+                }
+                const double iterations = static_cast<double>( m_intervals ) *
+                                          iterationsPerInterval;
+                result.push_back(
+                    { "allocations", static_cast<double>( m_total.allocations ) / iterations } );
+                result.push_back(
+                    { "frees", static_cast<double>( m_total.frees ) / iterations } );
+                result.push_back(
+                    { "allocated-bytes", static_cast<double>( m_total.bytes ) / iterations } );
+                return result;
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#if defined( CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS )
+void* operator new( std::size_t size ) {
+    if ( void* ptr = Catch::Benchmark::Detail::trackedAllocate( size ) ) {
+        return ptr;
+    }
+    Catch::throw_exception( std::bad_alloc() );
+}
+void* operator new[]( std::size_t size ) {
+    if ( void* ptr = Catch::Benchmark::Detail::trackedAllocate( size ) ) {
+        return ptr;
+    }
+    Catch::throw_exception( std::bad_alloc() );
+}
+void* operator new( std::size_t size, std::nothrow_t const& ) noexcept {
+    void* ptr = nullptr;
+    // New handler is allowed to throw std::bad_alloc
+    CATCH_TRY {
+        ptr = Catch::Benchmark::Detail::trackedAllocate( size );
+    } CATCH_CATCH_ALL {}
+    return ptr;
+}
+void* operator new[]( std::size_t size, std::nothrow_t const& ) noexcept {
+    void* ptr = nullptr;
+    // New handler is allowed to throw std::bad_alloc
+    CATCH_TRY {
+        ptr = Catch::Benchmark::Detail::trackedAllocate( size );
+    } CATCH_CATCH_ALL {}
+    return ptr;
+}
+void operator delete( void* ptr ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+void operator delete[]( void* ptr ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+void operator delete( void* ptr, std::size_t ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+void operator delete[]( void* ptr, std::size_t ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+void operator delete( void* ptr, std::nothrow_t const& ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+void operator delete[]( void* ptr, std::nothrow_t const& ) noexcept {
+    Catch::Benchmark::Detail::trackedFree( ptr );
+}
+#endif // CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS
+
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_ALLOCATION_TRACKER_CPP_INCLUDED
+// END Amalgamated content from catch_allocation_tracker.cpp (@wolfram77)
@@ -11,7 +11,9 @@
 
 #include "../catch_clock.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_sample_analysis.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <vector>
 
 namespace Catch {
     class IConfig;
@@ -19,6 +21,14 @@ namespace Catch {
     namespace Benchmark {
         namespace Detail {
             SampleAnalysis analyse(const IConfig &cfg, FDuration* first, FDuration* last);
+
+            //! Estimates the percentiles given by `IConfig::benchmarkPercentiles`,
+            //! only the points without analysis
+            std::vector<BenchmarkPercentile> analyse_percentiles(const IConfig &cfg, FDuration const* first, FDuration const* last);
+
+            //! Mean absolute difference between consecutive iterations,
+            //! zero for fewer than two
+            FDuration analyse_jitter(FDuration const* first, FDuration const* last);
         } // namespace Detail
     } // namespace Benchmark
 } // namespace Catch
@@ -46,6 +56,7 @@ namespace Catch {
 #include "../../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
 #include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <cmath>
 #include <vector>
 
 namespace Catch {
@@ -62,6 +73,8 @@ namespace Catch {
                     auto analysis = Catch::Benchmark::Detail::analyse_samples(
                         cfg.benchmarkConfidenceInterval(),
                         cfg.benchmarkResamples(),
+                        cfg.benchmarkAnalysisThreads(),
+                        cfg.rngSeed(),
                         samples.data(),
                         samples.data() + samples.size() );
                     auto outliers = Catch::Benchmark::Detail::classify_outliers(
@@ -112,6 +125,50 @@ namespace Catch {
                     };
                 }
             }
+
+            std::vector<BenchmarkPercentile> analyse_percentiles(const IConfig &cfg, FDuration const* first, FDuration const* last) {
+                std::vector<BenchmarkPercentile> result;
+                auto const& percentiles = cfg.benchmarkPercentiles();
+                if (percentiles.empty() || first == last) {
+                    return result;
+                }
+                std::vector<double> samples;
+                samples.reserve(static_cast<size_t>(last - first));
+                for (auto current = first; current != last; ++current) {
+                    samples.push_back( current->count() );
+                }
+                std::vector<double> quantiles;
+                quantiles.reserve(percentiles.size());
+                for (auto percentile : percentiles) {
+                    quantiles.push_back( percentile / 100. );
+                }
+
+                auto estimates = Catch::Benchmark::Detail::bootstrap_quantiles(
+                    cfg.benchmarkConfidenceInterval(),
+                    quantiles,
+                    samples.data(),
+                    samples.data() + samples.size() );
+                for (std::size_t i = 0; i < estimates.size(); ++i) {
+                    auto const& e = estimates[i];
+                    if (cfg.benchmarkNoAnalysis()) {
+                        result.push_back( { percentiles[i], { FDuration(e.point), FDuration(e.point), FDuration(e.point), 0.0 } } );
+                    } else {
+                        result.push_back( { percentiles[i], { FDuration(e.point), FDuration(e.lower_bound), FDuration(e.upper_bound), e.confidence_interval } } );
+                    }
+                }
+                return result;
+            }
+
+            FDuration analyse_jitter(FDuration const* first, FDuration const* last) {
+                if (last - first < 2) {
+                    return FDuration::zero();
+                }
+                double total = 0.;
+                for (auto current = first + 1; current != last; ++current) {
+                    total += std::abs( ( *current - *( current - 1 ) ).count() );
+                }
+                return FDuration( total / static_cast<double>( last - first - 1 ) );
+            }
         } // namespace Detail
     } // namespace Benchmark
 } // namespace Catch
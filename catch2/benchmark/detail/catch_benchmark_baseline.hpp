@@ -0,0 +1,250 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_BENCHMARK_BASELINE_HPP_INCLUDED
+#define CATCH_BENCHMARK_BASELINE_HPP_INCLUDED
+
+#include "../../reporters/catch_reporter_event_listener.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Catch {
+
+    struct TestCaseInfo;
+
+    /**
+     * Samples of benchmarks saved by a previous run, to compare against
+     *
+     * Baseline called `name` is stored in file `name.baseline` in the
+     * working directory, one benchmark per line: `persistentTestCaseHash`
+     * of its test case, number of samples, the samples in nanoseconds,
+     * and the name of the benchmark. The first line describes the CPU the
+     * samples were taken on, as `# cpu: ` and `describeCpuState`.
+     */
+    class BenchmarkBaseline {
+    public:
+        BenchmarkBaseline() = default;
+        //! Loads baseline from the file, missing file means empty baseline
+        explicit BenchmarkBaseline( std::string const& path );
+
+        static std::string pathFor( std::string const& name );
+
+        //! Returns null if the benchmark is not in the baseline
+        std::vector<double> const*
+        find( TestCaseInfo const& testInfo,
+              std::string const& benchmarkName ) const;
+        void record( TestCaseInfo const& testInfo,
+                     std::string const& benchmarkName,
+                     std::vector<Benchmark::FDuration> const& samples );
+
+        //! Description of the CPU of the last recorded run, empty if
+        //! it is not known
+        std::string const& cpu() const { return m_cpu; }
+        void setCpu( std::string cpu ) { m_cpu = CATCH_MOVE( cpu ); }
+
+        /**
+         * Writes the recorded benchmarks into the file, merged with the
+         * benchmarks it has by then, e.g. from other shards
+         *
+         * Returns false if the baseline could not be written.
+         */
+        bool save( std::string const& path ) const;
+
+    private:
+        using Key = std::pair<std::uint64_t, std::string>;
+        std::map<Key, std::vector<double>> m_benchmarks;
+        std::set<Key> m_recorded;
+        std::string m_cpu;
+    };
+
+    /**
+     * Saves samples of the executed benchmarks into the baseline given
+     * by `IConfig::benchmarkSaveBaseline`
+     *
+     * Benchmarks that did not run in this run are kept in the baseline.
+     */
+    class BenchmarkBaselineRecorder final : public EventListenerBase {
+    public:
+        BenchmarkBaselineRecorder( IConfig const* config );
+
+        void testCaseStarting( TestCaseInfo const& testInfo ) override;
+        void benchmarkEnded( BenchmarkStats<> const& benchmarkStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        BenchmarkBaseline m_baseline;
+        TestCaseInfo const* m_currentTestCase = nullptr;
+        bool m_recordedAny = false;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_BENCHMARK_BASELINE_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_benchmark_baseline.cpp (@wolfram77)
+#ifndef CATCH_BENCHMARK_BASELINE_CPP_INCLUDED
+#define CATCH_BENCHMARK_BASELINE_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_benchmark_baseline.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_test_case_info_hasher.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace Catch {
+
+    namespace {
+        constexpr StringRef baselineCpuPrefix = "# cpu: "_sr;
+    } // end unnamed namespace
+
+    BenchmarkBaseline::BenchmarkBaseline( std::string const& path ) {
+        std::string contents;
+        if ( path.empty() || !Detail::readWholeFile( path, contents ) ) {
+            return;
+        }
+
+        std::istringstream in( contents );
+        std::string line;
+        while ( std::getline( in, line ) ) {
+            if ( line.compare( 0, baselineCpuPrefix.size(), baselineCpuPrefix.data() ) == 0 ) {
+                m_cpu = line.substr( baselineCpuPrefix.size() );
+                continue;
+            }
+            std::istringstream lineStream( line );
+            std::uint64_t hash;
+            std::size_t sampleCount;
+            if ( !( lineStream >> std::hex >> hash >> std::dec >> sampleCount ) ||
+                 sampleCount == 0 ) {
+                // Silently skip malformed lines, like other persisted files
+                continue;
+            }
+            std::vector<double> samples( sampleCount );
+            for ( auto& sample : samples ) {
+                lineStream >> sample;
+            }
+            std::string name;
+            if ( !lineStream || !std::getline( lineStream >> std::ws, name ) ) {
+                continue;
+            }
+            m_benchmarks[{ hash, CATCH_MOVE( name ) }] = CATCH_MOVE( samples );
+        }
+    }
+
+    std::string BenchmarkBaseline::pathFor( std::string const& name ) {
+        return name + ".baseline";
+    }
+
+    std::vector<double> const*
+    BenchmarkBaseline::find( TestCaseInfo const& testInfo,
+                             std::string const& benchmarkName ) const {
+        auto it = m_benchmarks.find(
+            { persistentTestCaseHash( testInfo ), benchmarkName } );
+        return it != m_benchmarks.end() ? &it->second : nullptr;
+    }
+
+    void BenchmarkBaseline::record(
+        TestCaseInfo const& testInfo,
+        std::string const& benchmarkName,
+        std::vector<Benchmark::FDuration> const& samples ) {
+        Key key{ persistentTestCaseHash( testInfo ), benchmarkName };
+        m_recorded.insert( key );
+        auto& recorded = m_benchmarks[CATCH_MOVE( key )];
+        recorded.clear();
+        recorded.reserve( samples.size() );
+        for ( auto const& sample : samples ) {
+            recorded.push_back( sample.count() );
+        }
+    }
+
+    bool BenchmarkBaseline::save( std::string const& path ) const {
+        Detail::FileLock lock( path );
+        BenchmarkBaseline merged( path );
+        for ( auto const& key : m_recorded ) {
+            merged.m_benchmarks[key] = m_benchmarks.at( key );
+        }
+        if ( !m_recorded.empty() ) {
+            merged.m_cpu = m_cpu;
+        }
+
+        std::ostringstream out;
+        // The samples have to survive the round trip exactly
+        out << std::setprecision( std::numeric_limits<double>::max_digits10 );
+        if ( !merged.m_cpu.empty() ) {
+            out << baselineCpuPrefix << merged.m_cpu << '\n';
+        }
+        for ( auto const& benchmark : merged.m_benchmarks ) {
+            if ( benchmark.second.empty() ) {
+                continue;
+            }
+            out << std::hex << std::setw( 16 ) << std::setfill( '0' )
+                << benchmark.first.first << std::dec << ' '
+                << benchmark.second.size();
+            for ( const double sample : benchmark.second ) {
+                out << ' ' << sample;
+            }
+            out << ' ' << benchmark.first.second << '\n';
+        }
+        return Detail::replaceFileAtomically( path, out.str() );
+    }
+
+    BenchmarkBaselineRecorder::BenchmarkBaselineRecorder( IConfig const* config ):
+        EventListenerBase( config ),
+        m_baseline( BenchmarkBaseline::pathFor(
+            config->benchmarkSaveBaseline() ) ) {}
+
+    void BenchmarkBaselineRecorder::testCaseStarting( TestCaseInfo const& testInfo ) {
+        m_currentTestCase = &testInfo;
+    }
+
+    void BenchmarkBaselineRecorder::benchmarkEnded(
+        BenchmarkStats<> const& benchmarkStats ) {
+        if ( !m_currentTestCase || benchmarkStats.samples.empty() ) {
+            return;
+        }
+        m_baseline.record(
+            *m_currentTestCase, benchmarkStats.info.name, benchmarkStats.samples );
+        m_baseline.setCpu(
+            Benchmark::Detail::describeCpuState( benchmarkStats.info.cpu ) );
+        m_recordedAny = true;
+    }
+
+    void BenchmarkBaselineRecorder::testRunEnded( TestRunStats const& ) {
+        if ( !m_recordedAny ) {
+            return;
+        }
+        const auto path =
+            BenchmarkBaseline::pathFor( m_config->benchmarkSaveBaseline() );
+        if ( !m_baseline.save( path ) ) {
+            Catch::cerr() << "Warning: could not write benchmark baseline to '"
+                          << path << "'\n";
+        }
+    }
+
+} // end namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_BENCHMARK_BASELINE_CPP_INCLUDED
+// END Amalgamated content from catch_benchmark_baseline.cpp (@wolfram77)
@@ -0,0 +1,239 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_BENCHMARK_FAMILY_HPP_INCLUDED
+#define CATCH_BENCHMARK_FAMILY_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_complexity.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_source_line_info.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+
+        //! Values `first`, `first + step`, ... up to `last` inclusive
+        std::vector<std::uint64_t> linearRange( std::uint64_t first,
+                                                std::uint64_t last,
+                                                std::uint64_t step = 1 );
+        //! Values `first`, `first * factor`, ... up to `last` inclusive
+        std::vector<std::uint64_t> geometricRange( std::uint64_t first,
+                                                   std::uint64_t last,
+                                                   std::uint64_t factor = 10 );
+
+        namespace Detail {
+
+            /**
+             * Benchmarks that run the same code for different values of
+             * a parameter
+             *
+             * Every point of the family is a separate benchmark, named
+             * after the family and the value, e.g. "push [threads=4]".
+             * Reporters see the family, the parameter and its value in
+             * `BenchmarkInfo`, so they can group the points back together.
+             */
+            class BenchmarkFamily {
+            public:
+                BenchmarkFamily( std::string name, std::string parameter );
+                virtual ~BenchmarkFamily(); // = default
+
+                std::string const& name() const { return m_name; }
+                std::string const& parameter() const { return m_parameter; }
+
+                std::string pointName( std::uint64_t value ) const;
+
+                //! Called with stats of every point, in the order the
+                //! points run, before they are reported
+                virtual void pointMeasured( BenchmarkStats<>& stats );
+
+            private:
+                std::string m_name;
+                std::string m_parameter;
+            };
+
+            /**
+             * Family sweeping over the number of threads running the
+             * benchmark concurrently
+             *
+             * The mean of every point is the time for all threads to finish
+             * one iteration each, so with linear scaling it stays the same
+             * as the single thread point's. Scaling efficiency of a point is
+             * the single thread point's mean divided by its mean, whichever
+             * thread counts are listed and in whatever order.
+             *
+             * The single thread point has to be measured first, points
+             * measured without it get no efficiency.
+             */
+            class ThreadScalingFamily final : public BenchmarkFamily {
+            public:
+                explicit ThreadScalingFamily( std::string name );
+
+                void pointMeasured( BenchmarkStats<>& stats ) override;
+
+            private:
+                Optional<double> m_referenceMean;
+            };
+
+            /**
+             * Family sweeping over the size of the input, `n`
+             *
+             * After the last point is measured, the means of all points
+             * are fitted against the known complexities, and the best fit
+             * is reported with the last point.
+             */
+            class ComplexityFamily final : public BenchmarkFamily {
+            public:
+                ComplexityFamily( std::string name, std::size_t points );
+
+                void pointMeasured( BenchmarkStats<>& stats ) override;
+
+                //! Fails the running test if the fitted complexity is
+                //! worse than the expected one
+                void checkComplexity( Complexity expected,
+                                      SourceLineInfo const& lineInfo ) const;
+
+            private:
+                std::size_t m_points;
+                std::vector<std::uint64_t> m_values;
+                std::vector<double> m_means;
+                Optional<ComplexityFit> m_fit;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_BENCHMARK_FAMILY_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_benchmark_family.cpp (@wolfram77)
+#ifndef CATCH_BENCHMARK_FAMILY_CPP_INCLUDED
+#define CATCH_BENCHMARK_FAMILY_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_benchmark_family.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_capture.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_assertion_handler.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_reusable_string_stream.hpp"  // Adjust to relative path (@wolfram77)
+
+namespace Catch {
+    namespace Benchmark {
+
+        std::vector<std::uint64_t> linearRange( std::uint64_t first,
+                                                std::uint64_t last,
+                                                std::uint64_t step ) {
+            CATCH_ENFORCE( step > 0, "Step of linear range must be positive" );
+            std::vector<std::uint64_t> values;
+            for ( auto value = first; value <= last; value += step ) {
+                values.push_back( value );
+                if ( last - value < step ) {
+                    break;
+                }
+            }
+            return values;
+        }
+
+        std::vector<std::uint64_t> geometricRange( std::uint64_t first,
+                                                   std::uint64_t last,
+                                                   std::uint64_t factor ) {
+            CATCH_ENFORCE( first > 0 && factor > 1,
+                           "Geometric range needs positive start and factor "
+                           "greater than 1" );
+            std::vector<std::uint64_t> values;
+            for ( auto value = first; value <= last; value *= factor ) {
+                values.push_back( value );
+                if ( last / factor < value ) {
+                    break;
+                }
+            }
+            return values;
+        }
+
+        namespace Detail {
+
+            BenchmarkFamily::BenchmarkFamily( std::string name,
+                                              std::string parameter ):
+                m_name( CATCH_MOVE( name ) ),
+                m_parameter( CATCH_MOVE( parameter ) ) {}
+
+            BenchmarkFamily::~BenchmarkFamily() = default;
+
+            std::string BenchmarkFamily::pointName( std::uint64_t value ) const {
+                return m_name + " [" + m_parameter + '=' +
+                       std::to_string( value ) + ']';
+            }
+
+            void BenchmarkFamily::pointMeasured( BenchmarkStats<>& ) {}
+
+            ThreadScalingFamily::ThreadScalingFamily( std::string name ):
+                BenchmarkFamily( CATCH_MOVE( name ), "threads" ) {}
+
+            void ThreadScalingFamily::pointMeasured( BenchmarkStats<>& stats ) {
+                const double mean = stats.mean.point.count();
+                if ( stats.info.parameterValue == 1 ) {
+                    m_referenceMean = mean;
+                }
+                if ( m_referenceMean && mean > 0. ) {
+                    stats.scalingEfficiency = *m_referenceMean / mean;
+                }
+            }
+
+            ComplexityFamily::ComplexityFamily( std::string name,
+                                                std::size_t points ):
+                BenchmarkFamily( CATCH_MOVE( name ), "n" ),
+                m_points( points ) {
+                m_values.reserve( points );
+                m_means.reserve( points );
+            }
+
+            void ComplexityFamily::pointMeasured( BenchmarkStats<>& stats ) {
+                m_values.push_back( stats.info.parameterValue );
+                m_means.push_back( stats.mean.point.count() );
+                if ( m_values.size() == m_points && m_points >= 2 ) {
+                    m_fit = fitComplexity( m_values, m_means );
+                    stats.complexity = m_fit;
+                }
+            }
+
+            void ComplexityFamily::checkComplexity(
+                Complexity expected, SourceLineInfo const& lineInfo ) const {
+                if ( !m_fit || m_fit->complexity <= expected ) {
+                    return;
+                }
+                ReusableStringStream rss;
+                rss << "Benchmark family '" << name() << "' scales as "
+                    << complexityName( m_fit->complexity ) << " (RMS error "
+                    << m_fit->rms * 100. << "%), expected at most "
+                    << complexityName( expected );
+                AssertionReaction reaction;
+                getResultCapture().handleMessage(
+                    AssertionInfo{ "BENCHMARK_FAMILY"_sr,
+                                   lineInfo,
+                                   StringRef(),
+                                   ResultDisposition::ContinueOnFailure },
+                    ResultWas::ExplicitFailure,
+                    rss.str(),
+                    reaction );
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_BENCHMARK_FAMILY_CPP_INCLUDED
+// END Amalgamated content from catch_benchmark_family.cpp (@wolfram77)
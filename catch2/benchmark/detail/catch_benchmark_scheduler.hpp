@@ -0,0 +1,246 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_BENCHMARK_SCHEDULER_HPP_INCLUDED
+#define CATCH_BENCHMARK_SCHEDULER_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_unique_ptr.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            /**
+             * Lets only one thread run benchmarks at a time
+             *
+             * With `--jobs-mode thread`, benchmarks of test cases running
+             * at the same time would distort each other's timings. The lock
+             * is recursive, for benchmarks declared inside benchmarks.
+             */
+            class BenchmarkLock : Catch::Detail::NonCopyable {
+            public:
+                BenchmarkLock();
+                ~BenchmarkLock();
+            };
+
+            //! Prepared benchmark, sampled and analysed in separate steps
+            class ScheduledBenchmark {
+            public:
+                virtual ~ScheduledBenchmark(); // = default
+
+                virtual BenchmarkInfo const& info() const = 0;
+                //! Takes the next sample, false once there are enough
+                virtual bool sample() = 0;
+                //! Analyses the samples taken
+                virtual BenchmarkStats<> analyse() = 0;
+            };
+
+            /**
+             * Samples the benchmarks added to it in randomized round-robin
+             * order, one sample of each at a time
+             *
+             * Slow drift of the CPU frequency or temperature then affects
+             * all of them alike, rather than whichever ran last. The order
+             * of every round is drawn from the shared RNG, so `--rng-seed`
+             * reproduces it.
+             *
+             * While a scheduler exists, benchmarks are added to it instead
+             * of running right away. They are reported in the order they
+             * were added once all of them are sampled, because reporters
+             * expect the events of a benchmark together.
+             *
+             * Unlike benchmarks run on their own, interleaved benchmarks are
+             * not resampled when the CPU frequency drifts while they are
+             * sampled. The drift affects all of them alike, and is reported
+             * with their stats.
+             */
+            class BenchmarkScheduler {
+            public:
+                BenchmarkScheduler();
+                ~BenchmarkScheduler();
+
+                BenchmarkScheduler( BenchmarkScheduler const& ) = delete;
+                BenchmarkScheduler& operator=( BenchmarkScheduler const& ) = delete;
+
+                //! Scheduler benchmarks are added to, null if there is none
+                static BenchmarkScheduler* active();
+
+                void add( Catch::Detail::unique_ptr<ScheduledBenchmark> benchmark );
+
+                //! Samples and reports the added benchmarks. A failed
+                //! benchmark stops being sampled, the others are finished
+                //! before its exception is rethrown.
+                void run();
+
+            private:
+                struct Entry {
+                    Catch::Detail::unique_ptr<ScheduledBenchmark> benchmark;
+                    std::exception_ptr exception;
+                    std::string error;
+                };
+                std::vector<Entry> m_benchmarks;
+                BenchmarkScheduler* m_previous;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_BENCHMARK_SCHEDULER_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_benchmark_scheduler.cpp (@wolfram77)
+#ifndef CATCH_BENCHMARK_SCHEDULER_CPP_INCLUDED
+#define CATCH_BENCHMARK_SCHEDULER_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_benchmark_scheduler.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_capture.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_registry_hub.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_random_number_generator.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_thread_local.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_uniform_integer_distribution.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstddef>
+#include <utility>
+
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+#    include <mutex>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                // Benchmarks run on the thread running the test, and with
+                // `--jobs-mode thread` other threads run other test cases
+                CATCH_INTERNAL_THREAD_LOCAL BenchmarkScheduler* activeScheduler = nullptr;
+
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+                CATCH_INTERNAL_START_WARNINGS_SUPPRESSION
+                CATCH_INTERNAL_SUPPRESS_GLOBALS_WARNINGS
+                std::recursive_mutex& benchmarkMutex() {
+                    static std::recursive_mutex mutex;
+                    return mutex;
+                }
+                CATCH_INTERNAL_STOP_WARNINGS_SUPPRESSION
+#endif
+            } // end unnamed namespace
+
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+            BenchmarkLock::BenchmarkLock() { benchmarkMutex().lock(); }
+            BenchmarkLock::~BenchmarkLock() { benchmarkMutex().unlock(); }
+#else
+            // Without thread safe assertions, tests run on a single thread
+            BenchmarkLock::BenchmarkLock() = default;
+            BenchmarkLock::~BenchmarkLock() = default;
+#endif
+
+            ScheduledBenchmark::~ScheduledBenchmark() = default;
+
+            BenchmarkScheduler::BenchmarkScheduler():
+                m_previous( activeScheduler ) {
+                activeScheduler = this;
+            }
+
+            BenchmarkScheduler::~BenchmarkScheduler() {
+                activeScheduler = m_previous;
+            }
+
+            BenchmarkScheduler* BenchmarkScheduler::active() {
+                return activeScheduler;
+            }
+
+            void BenchmarkScheduler::add( Catch::Detail::unique_ptr<ScheduledBenchmark> benchmark ) {
+                m_benchmarks.push_back( { CATCH_MOVE( benchmark ), nullptr, std::string() } );
+            }
+
+            void BenchmarkScheduler::run() {
+                BenchmarkLock lock;
+                // The benchmarks were prepared on the pinned CPU, and their
+                // info says so, but the pins were released since
+                auto const* cfg = getCurrentContext().getConfig();
+                Catch::Detail::unique_ptr<ScopedCpuPin> pin;
+                if ( cfg->benchmarkCpu() >= 0 && !m_benchmarks.empty() ) {
+                    pin = Catch::Detail::make_unique<ScopedCpuPin>( cfg->benchmarkCpu() );
+                }
+                // Benchmarks declared by the sampled code run right away,
+                // rather than being added to the entries being sampled
+                activeScheduler = m_previous;
+
+                std::vector<std::size_t> sampling;
+                sampling.reserve( m_benchmarks.size() );
+                for ( std::size_t i = 0; i < m_benchmarks.size(); ++i ) {
+                    sampling.push_back( i );
+                }
+                auto& rng = sharedRng();
+                while ( !sampling.empty() ) {
+                    // Fisher-Yates with our own distribution, so that the
+                    // order does not depend on the standard library
+                    for ( std::size_t i = sampling.size() - 1; i > 0; --i ) {
+                        uniform_integer_distribution<std::size_t> pick( 0, i );
+                        std::swap( sampling[i], sampling[pick( rng )] );
+                    }
+                    std::size_t kept = 0;
+                    for ( const auto index : sampling ) {
+                        auto& entry = m_benchmarks[index];
+                        bool done = true;
+                        CATCH_TRY {
+                            done = !entry.benchmark->sample();
+                        } CATCH_CATCH_ALL {
+                            entry.error = translateActiveException();
+                            entry.exception = std::current_exception();
+                        }
+                        if ( !done ) {
+                            sampling[kept++] = index;
+                        }
+                    }
+                    sampling.resize( kept );
+                }
+
+                std::exception_ptr failure;
+                auto& capture = getResultCapture();
+                for ( auto& entry : m_benchmarks ) {
+                    capture.benchmarkPreparing( entry.benchmark->info().name );
+                    if ( entry.exception ) {
+                        capture.benchmarkFailed( entry.error );
+                        if ( !failure ) {
+                            failure = entry.exception;
+                        }
+                        continue;
+                    }
+                    capture.benchmarkStarting( entry.benchmark->info() );
+                    capture.benchmarkEnded( entry.benchmark->analyse() );
+                }
+                m_benchmarks.clear();
+                if ( failure ) {
+                    std::rethrow_exception( failure );
+                }
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_BENCHMARK_SCHEDULER_CPP_INCLUDED
+// END Amalgamated content from catch_benchmark_scheduler.cpp (@wolfram77)
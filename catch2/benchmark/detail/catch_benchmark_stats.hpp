@@ -8,17 +8,37 @@
 #ifndef CATCH_BENCHMARK_STATS_HPP_INCLUDED
 #define CATCH_BENCHMARK_STATS_HPP_INCLUDED
 
+#include "../catch_complexity.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_estimate.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_outlier_classification.hpp"  // Adjust to relative path (@wolfram77)
 // The fwd decl & default specialization needs to be seen by VS2017 before
 // BenchmarkStats itself, or VS2017 will report compilation error.
 #include "catch_benchmark_stats_fwd.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 namespace Catch {
 
+    enum class TurboBoost { Unknown, Enabled, Disabled };
+
+    //! State of the CPU running the benchmark, as far as it is known
+    struct BenchmarkCpuState {
+        //! CPU the benchmark started on, -1 if unknown
+        int cpu;
+        //! Was the benchmarking thread pinned to `cpu`?
+        bool pinned;
+        //! Model name of the CPU, empty if unknown
+        std::string model;
+        //! Frequency scaling governor, e.g. "performance", empty if unknown
+        std::string governor;
+        //! Frequency of `cpu` in MHz before the samples, 0 if unknown
+        double frequency;
+        TurboBoost turbo;
+    };
+
     struct BenchmarkInfo {
         std::string name;
         double estimatedDuration;
@@ -27,6 +47,53 @@ namespace Catch {
         unsigned int resamples;
         double clockResolution;
         double clockCost;
+        //! Family of benchmarks sweeping over a parameter this benchmark
+        //! belongs to, empty for standalone benchmarks
+        std::string family;
+        //! Name of the swept parameter, e.g. "threads"
+        std::string parameter;
+        std::uint64_t parameterValue;
+        //! Were the data caches evicted before every iteration?
+        bool coldCache;
+        BenchmarkCpuState cpu;
+    };
+
+    //! Value of a counter measured alongside the benchmark, per iteration
+    struct BenchmarkCounter {
+        std::string name;
+        double value;
+    };
+
+    namespace Benchmark {
+        //! How values reported to a user counter are aggregated
+        enum class CounterMode {
+            //! Summed, and reported per iteration
+            Sum,
+            //! Averaged over all reported values, e.g. for ratios
+            Average,
+            //! Summed, and reported per second of the measured time
+            Rate
+        };
+    } // namespace Benchmark
+
+    //! Counter reported by the benchmark itself through `Chronometer`
+    struct BenchmarkUserCounter {
+        std::string name;
+        double value;
+        Benchmark::CounterMode mode;
+    };
+
+    //! Percentile of the samples, e.g. 99.9 for p99.9
+    struct BenchmarkPercentile {
+        double percentile;
+        Benchmark::Estimate<Benchmark::FDuration> value;
+    };
+
+    //! Bucket of the latency histogram, bounds are in nanoseconds
+    struct BenchmarkHistogramBucket {
+        double lowerBound;
+        double upperBound;
+        std::uint64_t count;
     };
 
     // We need to keep template parameter for backwards compatibility,
@@ -40,6 +107,35 @@ namespace Catch {
         Benchmark::Estimate<Benchmark::FDuration> standardDeviation;
         Benchmark::OutlierClassification outliers;
         double outlierVariance;
+        std::vector<BenchmarkCounter> counters;
+        //! Ratio of the mean to the mean in compared baseline, if any
+        Optional<Benchmark::Estimate<double>> baselineRatio;
+        //! Throughput per thread relative to the single thread point of
+        //! the thread scaling family, 1 is linear scaling
+        Optional<double> scalingEfficiency;
+        //! Complexity fitted to the means of all points of the family,
+        //! set on the last point only
+        Optional<Benchmark::ComplexityFit> complexity;
+        //! Relative change of the CPU frequency from before to after
+        //! the samples, if the frequency is known
+        Optional<double> frequencyDrift;
+        //! Throughput of the bytes and items processed by an iteration,
+        //! if the benchmark declared them
+        Optional<double> bytesPerSecond;
+        Optional<double> itemsPerSecond;
+        std::vector<BenchmarkUserCounter> userCounters;
+        //! Estimates of the percentiles given by `--benchmark-percentiles`
+        std::vector<BenchmarkPercentile> percentiles;
+        //! Non-empty buckets of the latency histogram in ascending order,
+        //! empty unless `--benchmark-histogram` was given
+        std::vector<BenchmarkHistogramBucket> histogram;
+        //! Slowest iteration and mean difference between consecutive
+        //! iterations, set when every iteration was timed on its own
+        Optional<Benchmark::FDuration> maxIteration;
+        Optional<Benchmark::FDuration> iterationJitter;
+        //! Problems with the measurement, which the run context reports
+        //! as warnings once the benchmark has been reported
+        std::vector<std::string> warnings;
     };
 
 
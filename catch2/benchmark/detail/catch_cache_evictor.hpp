@@ -0,0 +1,143 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_CACHE_EVICTOR_HPP_INCLUDED
+#define CATCH_CACHE_EVICTOR_HPP_INCLUDED
+
+#include "../../internal/catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstddef>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Size of the biggest data (or unified) cache in bytes, read
+            //! from sysfs on Linux, 0 if it is not known
+            std::size_t largestDataCacheSize();
+
+            /**
+             * Evicts benchmark data from the CPU data caches
+             *
+             * Streams over a buffer twice the size of the biggest data
+             * cache, so that even caches with non-LRU replacement policies
+             * end up holding only the buffer. If the cache size is not
+             * known, 64 MiB are used.
+             */
+            class CacheEvictor : Catch::Detail::NonCopyable {
+            public:
+                CacheEvictor();
+
+                void evict();
+
+            private:
+                std::vector<unsigned char> m_buffer;
+                unsigned char m_pass = 0;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_CACHE_EVICTOR_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_cache_evictor.cpp (@wolfram77)
+#ifndef CATCH_CACHE_EVICTOR_CPP_INCLUDED
+#define CATCH_CACHE_EVICTOR_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_cache_evictor.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../catch_optimizer.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <string>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                // Stride of the eviction pass, touching every cache line
+                // of all CPUs we care about
+                constexpr std::size_t cacheLineSize = 64;
+                constexpr std::size_t fallbackBufferSize = 64 * 1024 * 1024;
+
+                //! Parses sizes like "48K" or "32M" used by sysfs
+                std::size_t parseCacheSize( std::string const& text ) {
+                    std::size_t size = 0;
+                    std::size_t i = 0;
+                    for ( ; i < text.size() && text[i] >= '0' && text[i] <= '9'; ++i ) {
+                        size = size * 10 + static_cast<std::size_t>( text[i] - '0' );
+                    }
+                    if ( i < text.size() ) {
+                        if ( text[i] == 'K' ) {
+                            size *= 1024;
+                        } else if ( text[i] == 'M' ) {
+                            size *= 1024 * 1024;
+                        } else if ( text[i] == 'G' ) {
+                            size *= 1024 * 1024 * 1024;
+                        }
+                    }
+                    return size;
+                }
+            } // end unnamed namespace
+
+            std::size_t largestDataCacheSize() {
+                std::size_t largest = 0;
+#if defined( CATCH_PLATFORM_LINUX )
+                for ( int index = 0;; ++index ) {
+                    const std::string dir =
+                        "/sys/devices/system/cpu/cpu0/cache/index" +
+                        std::to_string( index ) + '/';
+                    std::string type, size;
+                    if ( !Catch::Detail::readWholeFile( dir + "type", type ) ||
+                         !Catch::Detail::readWholeFile( dir + "size", size ) ) {
+                        break;
+                    }
+                    if ( type.compare( 0, 11, "Instruction" ) == 0 ) {
+                        continue;
+                    }
+                    const auto cacheSize = parseCacheSize( size );
+                    if ( cacheSize > largest ) {
+                        largest = cacheSize;
+                    }
+                }
+#endif
+                return largest;
+            }
+
+            CacheEvictor::CacheEvictor() {
+                const auto cacheSize = largestDataCacheSize();
+                // Touch the whole buffer now, so that page faults are not
+                // part of the first eviction
+                m_buffer.assign(
+                    cacheSize > 0 ? 2 * cacheSize : fallbackBufferSize, 1 );
+            }
+
+            void CacheEvictor::evict() {
+                // Modifying the buffer keeps the pass from being optimized
+                // away, and the lines are dirty like real working sets are
+                ++m_pass;
+                for ( std::size_t i = 0; i < m_buffer.size(); i += cacheLineSize ) {
+                    m_buffer[i] = static_cast<unsigned char>( m_buffer[i] + m_pass );
+                }
+                keep_memory( m_buffer.data() );
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_CACHE_EVICTOR_CPP_INCLUDED
+// END Amalgamated content from catch_cache_evictor.cpp (@wolfram77)
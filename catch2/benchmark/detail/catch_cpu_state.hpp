@@ -0,0 +1,318 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_CPU_STATE_HPP_INCLUDED
+#define CATCH_CPU_STATE_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <string>
+#include <vector>
+
+namespace Catch {
+
+    //! "on", "off" or "unknown"
+    StringRef turboBoostName( TurboBoost turbo );
+
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Samples are taken again if the CPU frequency after them
+            //! differs by more than this from the frequency before them
+            constexpr double maximumFrequencyDrift = 0.05;
+            //! How many times the samples are retaken before the drifted
+            //! ones are reported
+            constexpr int frequencyDriftRetries = 2;
+
+            //! CPUs a thread may run on, empty if unknown
+            class CpuAffinity {
+            public:
+                //! Affinity of the calling thread
+                static CpuAffinity current();
+                //! Gives the calling thread this affinity, if it is known
+                void apply() const;
+
+            private:
+                std::vector<int> m_cpus;
+            };
+
+            /**
+             * Pins the calling thread to the CPU for the lifetime of the
+             * object, and then restores its previous affinity
+             *
+             * Throws if pinning fails or is not supported on this platform
+             * (only Linux is). Threads started by the pinned thread inherit
+             * the pin, see `unpinnedAffinity`.
+             */
+            class ScopedCpuPin : Catch::Detail::NonCopyable {
+            public:
+                explicit ScopedCpuPin( int cpu );
+                ~ScopedCpuPin();
+
+            private:
+                friend CpuAffinity unpinnedAffinity();
+
+                CpuAffinity m_previous;
+                ScopedCpuPin const* m_outer;
+            };
+
+            //! Affinity the calling thread had before its outermost active
+            //! `ScopedCpuPin`, or its current affinity if it is not pinned
+            CpuAffinity unpinnedAffinity();
+            //! CPU the calling thread runs on, -1 if unknown
+            int currentCpu();
+            //! Current frequency of the CPU in MHz, 0 if unknown
+            double cpuFrequency( int cpu );
+            //! Model name of the CPU, read once, empty if unknown
+            std::string const& cpuModel();
+
+            /**
+             * Reads frequency scaling state of the CPU, from sysfs on Linux
+             *
+             * Turbo boost is read from `intel_pstate/no_turbo` or, for
+             * other drivers, from `cpufreq/boost`.
+             */
+            BenchmarkCpuState readCpuState( int cpu, bool pinned );
+
+            //! Describes the parts of the state that should match for
+            //! benchmark results to be comparable, e.g. in baselines
+            std::string describeCpuState( BenchmarkCpuState const& state );
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_CPU_STATE_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_cpu_state.cpp (@wolfram77)
+#ifndef CATCH_CPU_STATE_CPP_INCLUDED
+#define CATCH_CPU_STATE_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_cpu_state.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_getenv.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_thread_local.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdlib>
+#include <sstream>
+
+#if defined( CATCH_PLATFORM_LINUX )
+#    include <sched.h>
+#elif defined( CATCH_PLATFORM_MAC )
+#    include <sys/sysctl.h>
+#    include <sys/types.h>
+#endif
+
+namespace Catch {
+
+    StringRef turboBoostName( TurboBoost turbo ) {
+        switch ( turbo ) {
+        case TurboBoost::Unknown:
+            return "unknown"_sr;
+        case TurboBoost::Enabled:
+            return "on"_sr;
+        case TurboBoost::Disabled:
+            return "off"_sr;
+        }
+        CATCH_INTERNAL_ERROR( "Unknown turbo boost state" );
+    }
+
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                //! Returns the first line of the file, empty if it cannot
+                //! be read
+                std::string readSysfsValue( std::string const& path ) {
+                    std::string contents;
+                    if ( !Catch::Detail::readWholeFile( path, contents ) ) {
+                        return {};
+                    }
+                    return contents.substr( 0, contents.find( '\n' ) );
+                }
+
+                std::string cpufreqPath( int cpu, char const* file ) {
+                    return "/sys/devices/system/cpu/cpu" +
+                           std::to_string( cpu ) + "/cpufreq/" + file;
+                }
+
+                TurboBoost readTurboBoost() {
+                    const auto noTurbo = readSysfsValue(
+                        "/sys/devices/system/cpu/intel_pstate/no_turbo" );
+                    if ( !noTurbo.empty() ) {
+                        return noTurbo == "0" ? TurboBoost::Enabled
+                                              : TurboBoost::Disabled;
+                    }
+                    const auto boost = readSysfsValue(
+                        "/sys/devices/system/cpu/cpufreq/boost" );
+                    if ( !boost.empty() ) {
+                        return boost == "0" ? TurboBoost::Disabled
+                                            : TurboBoost::Enabled;
+                    }
+                    return TurboBoost::Unknown;
+                }
+
+                std::string readCpuModel() {
+#if defined( CATCH_PLATFORM_LINUX )
+                    std::string cpuinfo;
+                    if ( Catch::Detail::readWholeFile( "/proc/cpuinfo", cpuinfo ) ) {
+                        std::istringstream in( cpuinfo );
+                        std::string line;
+                        while ( std::getline( in, line ) ) {
+                            if ( line.compare( 0, 10, "model name" ) != 0 ) {
+                                continue;
+                            }
+                            const auto colon = line.find( ':' );
+                            if ( colon != std::string::npos ) {
+                                const auto start = line.find_first_not_of( ' ', colon + 1 );
+                                if ( start != std::string::npos ) {
+                                    return line.substr( start );
+                                }
+                            }
+                        }
+                    }
+#elif defined( CATCH_PLATFORM_MAC )
+                    char brand[256] = {};
+                    size_t size = sizeof( brand ) - 1;
+                    if ( sysctlbyname( "machdep.cpu.brand_string", brand, &size, nullptr, 0 ) == 0 ) {
+                        return brand;
+                    }
+#elif defined( CATCH_PLATFORM_WINDOWS )
+                    if ( auto identifier = Catch::Detail::getEnv( "PROCESSOR_IDENTIFIER" ) ) {
+                        return identifier;
+                    }
+#endif
+                    return {};
+                }
+
+                // Pins are per thread, and with `--jobs-mode thread` other
+                // threads run other test cases
+                CATCH_INTERNAL_THREAD_LOCAL ScopedCpuPin const* activePin = nullptr;
+            } // end unnamed namespace
+
+            CpuAffinity CpuAffinity::current() {
+                CpuAffinity affinity;
+#if defined( CATCH_PLATFORM_LINUX )
+                cpu_set_t cpus;
+                CPU_ZERO( &cpus );
+                if ( sched_getaffinity( 0, sizeof( cpus ), &cpus ) == 0 ) {
+                    for ( int cpu = 0; cpu < CPU_SETSIZE; ++cpu ) {
+                        if ( CPU_ISSET( static_cast<std::size_t>( cpu ), &cpus ) ) {
+                            affinity.m_cpus.push_back( cpu );
+                        }
+                    }
+                }
+#endif
+                return affinity;
+            }
+
+            void CpuAffinity::apply() const {
+#if defined( CATCH_PLATFORM_LINUX )
+                if ( m_cpus.empty() ) {
+                    return;
+                }
+                cpu_set_t cpus;
+                CPU_ZERO( &cpus );
+                for ( const int cpu : m_cpus ) {
+                    CPU_SET( static_cast<std::size_t>( cpu ), &cpus );
+                }
+                // Best effort, the thread keeps running either way
+                static_cast<void>( sched_setaffinity( 0, sizeof( cpus ), &cpus ) );
+#endif
+            }
+
+            ScopedCpuPin::ScopedCpuPin( int cpu ):
+                m_previous( CpuAffinity::current() ), m_outer( activePin ) {
+#if defined( CATCH_PLATFORM_LINUX )
+                CATCH_ENFORCE( cpu >= 0 && cpu < CPU_SETSIZE,
+                               "Invalid benchmark CPU " << cpu );
+                cpu_set_t cpus;
+                CPU_ZERO( &cpus );
+                CPU_SET( static_cast<std::size_t>( cpu ), &cpus );
+                CATCH_ENFORCE( sched_setaffinity( 0, sizeof( cpus ), &cpus ) == 0,
+                               "Could not pin benchmark to CPU " << cpu );
+#else
+                CATCH_RUNTIME_ERROR( "Pinning benchmarks to CPU "
+                                     << cpu << " is only supported on Linux" );
+#endif
+                activePin = this;
+            }
+
+            ScopedCpuPin::~ScopedCpuPin() {
+                activePin = m_outer;
+                m_previous.apply();
+            }
+
+            CpuAffinity unpinnedAffinity() {
+                if ( !activePin ) {
+                    return CpuAffinity::current();
+                }
+                auto const* outermost = activePin;
+                while ( outermost->m_outer ) {
+                    outermost = outermost->m_outer;
+                }
+                return outermost->m_previous;
+            }
+
+            int currentCpu() {
+#if defined( CATCH_PLATFORM_LINUX )
+                return sched_getcpu();
+#else
+                return -1;
+#endif
+            }
+
+            double cpuFrequency( int cpu ) {
+                if ( cpu < 0 ) {
+                    return 0.;
+                }
+                // In kHz
+                const auto frequency =
+                    readSysfsValue( cpufreqPath( cpu, "scaling_cur_freq" ) );
+                return std::strtod( frequency.c_str(), nullptr ) / 1000.;
+            }
+
+            std::string const& cpuModel() {
+                static const std::string model = readCpuModel();
+                return model;
+            }
+
+            BenchmarkCpuState readCpuState( int cpu, bool pinned ) {
+                return { cpu,
+                         pinned,
+                         cpuModel(),
+                         cpu >= 0 ? readSysfsValue( cpufreqPath( cpu, "scaling_governor" ) )
+                                  : std::string(),
+                         cpuFrequency( cpu ),
+                         readTurboBoost() };
+            }
+
+            std::string describeCpuState( BenchmarkCpuState const& state ) {
+                return ( state.model.empty() ? "unknown CPU" : state.model ) +
+                       " (governor: " +
+                       ( state.governor.empty() ? "unknown" : state.governor ) +
+                       ", turbo: " +
+                       static_cast<std::string>( turboBoostName( state.turbo ) ) +
+                       ')';
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_CPU_STATE_CPP_INCLUDED
+// END Amalgamated content from catch_cpu_state.cpp (@wolfram77)
@@ -0,0 +1,256 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_ENVIRONMENT_CACHE_HPP_INCLUDED
+#define CATCH_ENVIRONMENT_CACHE_HPP_INCLUDED
+
+#include "../catch_environment.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_tsc_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <chrono>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Name of the clock in the calibration cache, empty for clocks
+            //! whose calibration is never cached
+            template <typename Clock>
+            struct CalibrationClockName {
+                static StringRef name() { return StringRef(); }
+            };
+            // high_resolution_clock is an alias of one of these everywhere
+            template <>
+            struct CalibrationClockName<std::chrono::steady_clock> {
+                static StringRef name() { return "steady_clock"_sr; }
+            };
+            template <>
+            struct CalibrationClockName<std::chrono::system_clock> {
+                static StringRef name() { return "system_clock"_sr; }
+            };
+            template <>
+            struct CalibrationClockName<tsc_clock> {
+                static StringRef name() { return "tsc"_sr; }
+            };
+
+            /**
+             * Returns the clock environment stored in the calibration cache
+             * file given by `IConfig::benchmarkCalibrationCache`
+             *
+             * Entries are keyed by the host name, the CPU model and the
+             * clock, and expire a day after they were measured. Nothing is
+             * returned if there is no cache file, the entry is missing or
+             * expired, or `--benchmark-recalibrate` was passed.
+             */
+            Optional<Environment> loadCachedEnvironment( StringRef clockName );
+
+            //! Stores freshly measured environment into the calibration
+            //! cache file, if there is one. Expired entries are dropped.
+            void saveCachedEnvironment( StringRef clockName,
+                                        Environment const& env );
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_ENVIRONMENT_CACHE_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_environment_cache.cpp (@wolfram77)
+#ifndef CATCH_ENVIRONMENT_CACHE_CPP_INCLUDED
+#define CATCH_ENVIRONMENT_CACHE_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_environment_cache.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_getenv.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined( CATCH_PLATFORM_LINUX ) || defined( CATCH_PLATFORM_MAC )
+#    include <unistd.h>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                // Long enough to cover a day of CI runs, short enough to
+                // notice changed frequency scaling or kernel settings
+                constexpr std::int64_t calibrationTimeToLive = 24 * 60 * 60;
+
+                struct CachedEnvironment {
+                    std::int64_t measuredAt;
+                    Environment env;
+                    std::string key;
+                };
+
+                std::int64_t secondsSinceEpoch() {
+                    return std::chrono::duration_cast<std::chrono::seconds>(
+                               std::chrono::system_clock::now()
+                                   .time_since_epoch() )
+                        .count();
+                }
+
+                bool isFresh( std::int64_t measuredAt, std::int64_t now ) {
+                    // Entries from the future mean the clock was changed
+                    return measuredAt <= now &&
+                           now - measuredAt < calibrationTimeToLive;
+                }
+
+                std::string hostName() {
+#if defined( CATCH_PLATFORM_LINUX ) || defined( CATCH_PLATFORM_MAC )
+                    char name[256] = {};
+                    if ( gethostname( name, sizeof( name ) - 1 ) == 0 ) {
+                        return name;
+                    }
+#elif defined( CATCH_PLATFORM_WINDOWS )
+                    if ( auto name = Catch::Detail::getEnv( "COMPUTERNAME" ) ) {
+                        return name;
+                    }
+#endif
+                    return "unknown";
+                }
+
+                std::string cacheKey( StringRef clockName ) {
+                    const auto& model = cpuModel();
+                    return hostName() + '|' +
+                           ( model.empty() ? "unknown" : model ) + '|' +
+                           std::string( clockName );
+                }
+
+                bool readEstimate( std::istream& in, EnvironmentEstimate& estimate ) {
+                    double mean;
+                    auto& outliers = estimate.outliers;
+                    if ( !( in >> mean >> outliers.samples_seen >>
+                            outliers.low_severe >> outliers.low_mild >>
+                            outliers.high_mild >> outliers.high_severe ) ) {
+                        return false;
+                    }
+                    estimate.mean = FDuration( mean );
+                    return true;
+                }
+
+                void writeEstimate( std::ostream& out,
+                                    EnvironmentEstimate const& estimate ) {
+                    auto const& outliers = estimate.outliers;
+                    out << ' ' << estimate.mean.count() << ' '
+                        << outliers.samples_seen << ' ' << outliers.low_severe
+                        << ' ' << outliers.low_mild << ' ' << outliers.high_mild
+                        << ' ' << outliers.high_severe;
+                }
+
+                //! Every line is the measurement time, resolution and cost
+                //! estimates and the key, last because it contains spaces
+                std::vector<CachedEnvironment> readCache( std::string const& path ) {
+                    std::vector<CachedEnvironment> entries;
+                    std::string contents;
+                    if ( !Catch::Detail::readWholeFile( path, contents ) ) {
+                        return entries;
+                    }
+                    std::istringstream in( contents );
+                    std::string line;
+                    while ( std::getline( in, line ) ) {
+                        std::istringstream lineStream( line );
+                        CachedEnvironment entry{};
+                        if ( !( lineStream >> entry.measuredAt ) ||
+                             !readEstimate( lineStream, entry.env.clock_resolution ) ||
+                             !readEstimate( lineStream, entry.env.clock_cost ) ) {
+                            // Malformed lines just mean recalibrating
+                            continue;
+                        }
+                        std::getline( lineStream >> std::ws, entry.key );
+                        entries.push_back( CATCH_MOVE( entry ) );
+                    }
+                    return entries;
+                }
+
+                std::string const* cachePath() {
+                    auto const* config = getCurrentContext().getConfig();
+                    if ( !config || config->benchmarkCalibrationCache().empty() ) {
+                        return nullptr;
+                    }
+                    return &config->benchmarkCalibrationCache();
+                }
+            } // end unnamed namespace
+
+            Optional<Environment> loadCachedEnvironment( StringRef clockName ) {
+                auto const* path = cachePath();
+                if ( !path || clockName.empty() ||
+                     getCurrentContext().getConfig()->benchmarkRecalibrate() ) {
+                    return {};
+                }
+                const auto key = cacheKey( clockName );
+                const auto now = secondsSinceEpoch();
+                for ( auto const& entry : readCache( *path ) ) {
+                    if ( entry.key == key && isFresh( entry.measuredAt, now ) ) {
+                        return entry.env;
+                    }
+                }
+                return {};
+            }
+
+            void saveCachedEnvironment( StringRef clockName,
+                                        Environment const& env ) {
+                auto const* path = cachePath();
+                if ( !path || clockName.empty() ) {
+                    return;
+                }
+                const auto key = cacheKey( clockName );
+                const auto now = secondsSinceEpoch();
+                // Benchmark binaries sharing the file save concurrently
+                Catch::Detail::FileLock lock( *path );
+
+                std::ostringstream out;
+                out << std::setprecision( std::numeric_limits<double>::max_digits10 );
+                auto writeEntry = [&]( std::int64_t measuredAt,
+                                       Environment const& entryEnv,
+                                       std::string const& entryKey ) {
+                    out << measuredAt;
+                    writeEstimate( out, entryEnv.clock_resolution );
+                    writeEstimate( out, entryEnv.clock_cost );
+                    out << ' ' << entryKey << '\n';
+                };
+                // Other machines and clocks may share the file, e.g. on
+                // a network mounted home directory
+                for ( auto const& entry : readCache( *path ) ) {
+                    if ( entry.key != key && isFresh( entry.measuredAt, now ) ) {
+                        writeEntry( entry.measuredAt, entry.env, entry.key );
+                    }
+                }
+                writeEntry( now, env, key );
+
+                if ( !Catch::Detail::replaceFileAtomically( *path, out.str() ) ) {
+                    Catch::cerr() << "Warning: could not write clock calibration to '"
+                                  << *path << "'\n";
+                }
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_ENVIRONMENT_CACHE_CPP_INCLUDED
+// END Amalgamated content from catch_environment_cache.cpp (@wolfram77)
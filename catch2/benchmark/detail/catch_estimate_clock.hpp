@@ -12,10 +12,10 @@
 
 #include "../catch_clock.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_environment.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_environment_cache.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_stats.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_measure.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_run_for_at_least.hpp"  // Adjust to relative path (@wolfram77)
-#include "../../internal/catch_unique_ptr.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <algorithm>
 #include <vector>
@@ -47,6 +47,10 @@ namespace Catch {
             constexpr auto warmup_iterations = 10000;
             constexpr auto warmup_time = std::chrono::milliseconds(100);
             constexpr auto minimum_ticks = 1000;
+            // Iterations timed one by one must be this many clock
+            // resolutions and costs long, reading the clock after every
+            // one of them then distorts it by a percent at most
+            constexpr auto minimum_iteration_ticks = 100;
             constexpr auto warmup_seed = 10000;
             constexpr auto clock_resolution_estimation_time = std::chrono::milliseconds(500);
             constexpr auto clock_cost_estimation_time_limit = std::chrono::seconds(1);
@@ -100,24 +104,25 @@ namespace Catch {
 
             template <typename Clock>
             Environment measure_environment() {
-#if defined(__clang__)
-#    pragma clang diagnostic push
-#    pragma clang diagnostic ignored "-Wexit-time-destructors"
-#endif
-                static Catch::Detail::unique_ptr<Environment> env;
-#if defined(__clang__)
-#    pragma clang diagnostic pop
-#endif
-                if (env) {
-                    return *env;
-                }
+                // Initialized once per clock, also when benchmarks of test
+                // cases run by `--jobs-mode thread` ask at the same time
+                static const Environment env = [] {
+                    // Calibration takes over a second, which adds up quickly
+                    // across many benchmark binaries
+                    const auto clockName = CalibrationClockName<Clock>::name();
+                    if ( auto cached = loadCachedEnvironment( clockName ) ) {
+                        return *cached;
+                    }
 
-                auto iters = Detail::warmup<Clock>();
-                auto resolution = Detail::estimate_clock_resolution<Clock>(iters);
-                auto cost = Detail::estimate_clock_cost<Clock>(resolution.mean);
+                    auto iters = Detail::warmup<Clock>();
+                    auto resolution = Detail::estimate_clock_resolution<Clock>(iters);
+                    auto cost = Detail::estimate_clock_cost<Clock>(resolution.mean);
 
-                env = Catch::Detail::make_unique<Environment>( Environment{resolution, cost} );
-                return *env;
+                    const Environment measured{ resolution, cost };
+                    saveCachedEnvironment( clockName, measured );
+                    return measured;
+                }();
+                return env;
             }
         } // namespace Detail
     } // namespace Benchmark
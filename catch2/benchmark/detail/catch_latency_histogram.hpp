@@ -0,0 +1,151 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_LATENCY_HISTOGRAM_HPP_INCLUDED
+#define CATCH_LATENCY_HISTOGRAM_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_clock.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            /**
+             * Histogram of latencies with logarithmically sized buckets,
+             * like HDR histograms
+             *
+             * Latencies are counted in whole picoseconds. Below 128 ps
+             * every bucket is a picosecond wide, above that every power of
+             * two is split into 64 buckets, so no bucket is wider than
+             * 1/64 (1.6 %) of its lower bound. The buckets cover every
+             * latency `std::uint64_t` picoseconds can hold in the same
+             * memory however many latencies are recorded, so the histogram
+             * can also collect latencies of long running benchmarks.
+             */
+            class LatencyHistogram {
+            public:
+                LatencyHistogram();
+
+                void record( FDuration latency );
+
+                std::uint64_t count() const { return m_count; }
+
+                //! Non-empty buckets in ascending order
+                std::vector<BenchmarkHistogramBucket> buckets() const;
+
+            private:
+                std::vector<std::uint64_t> m_counts;
+                std::uint64_t m_count = 0;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_LATENCY_HISTOGRAM_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_latency_histogram.cpp (@wolfram77)
+#ifndef CATCH_LATENCY_HISTOGRAM_CPP_INCLUDED
+#define CATCH_LATENCY_HISTOGRAM_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_latency_histogram.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                // 2^subBucketBits buckets per power of two above the
+                // linear range, which is twice as long
+                constexpr unsigned subBucketBits = 6;
+                constexpr std::uint64_t subBucketCount = std::uint64_t( 1 ) << subBucketBits;
+                constexpr std::uint64_t linearLimit = 2 * subBucketCount;
+                constexpr std::size_t bucketCount = static_cast<std::size_t>(
+                    ( 64 - subBucketBits - 1 ) * subBucketCount + linearLimit );
+
+                unsigned highestBit( std::uint64_t value ) {
+                    unsigned bit = 0;
+                    for ( unsigned shift = 32; shift > 0; shift /= 2 ) {
+                        if ( value >> shift ) {
+                            value >>= shift;
+                            bit += shift;
+                        }
+                    }
+                    return bit;
+                }
+
+                std::size_t bucketIndex( std::uint64_t picoseconds ) {
+                    if ( picoseconds < linearLimit ) {
+                        return static_cast<std::size_t>( picoseconds );
+                    }
+                    const unsigned shift = highestBit( picoseconds ) - subBucketBits;
+                    return static_cast<std::size_t>(
+                        shift * subBucketCount + ( picoseconds >> shift ) );
+                }
+
+                //! Bounds of the bucket in picoseconds, upper is exclusive
+                void bucketBounds( std::size_t index, double& lower, double& upper ) {
+                    if ( index < linearLimit ) {
+                        lower = static_cast<double>( index );
+                        upper = lower + 1.;
+                        return;
+                    }
+                    const auto shift = static_cast<unsigned>( index / subBucketCount - 1 );
+                    const auto subBucket = index % subBucketCount + subBucketCount;
+                    lower = std::ldexp( static_cast<double>( subBucket ), static_cast<int>( shift ) );
+                    upper = std::ldexp( static_cast<double>( subBucket + 1 ), static_cast<int>( shift ) );
+                }
+            } // end unnamed namespace
+
+            LatencyHistogram::LatencyHistogram():
+                m_counts( bucketCount, 0 ) {}
+
+            void LatencyHistogram::record( FDuration latency ) {
+                const double picoseconds = latency.count() * 1000.;
+                std::uint64_t value = 0;
+                if ( picoseconds >= static_cast<double>( std::numeric_limits<std::uint64_t>::max() ) ) {
+                    value = std::numeric_limits<std::uint64_t>::max();
+                } else if ( picoseconds > 0. ) {
+                    value = static_cast<std::uint64_t>( picoseconds );
+                }
+                ++m_counts[bucketIndex( value )];
+                ++m_count;
+            }
+
+            std::vector<BenchmarkHistogramBucket> LatencyHistogram::buckets() const {
+                std::vector<BenchmarkHistogramBucket> result;
+                for ( std::size_t i = 0; i < m_counts.size(); ++i ) {
+                    if ( m_counts[i] == 0 ) {
+                        continue;
+                    }
+                    double lower, upper;
+                    bucketBounds( i, lower, upper );
+                    result.push_back( { lower / 1000., upper / 1000., m_counts[i] } );
+                }
+                return result;
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_LATENCY_HISTOGRAM_CPP_INCLUDED
+// END Amalgamated content from catch_latency_histogram.cpp (@wolfram77)
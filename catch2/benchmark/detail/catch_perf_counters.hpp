@@ -0,0 +1,330 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_PERF_COUNTERS_HPP_INCLUDED
+#define CATCH_PERF_COUNTERS_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Is `name` one of the counters `PerfCounterGroup` knows?
+            bool isKnownPerfCounter( StringRef name );
+            //! Comma separated names of all known counters, for help texts
+            StringRef knownPerfCounterNames();
+
+            /**
+             * Group of hardware performance counters that are read together
+             *
+             * On Linux, the counters are opened with `perf_event_open` as a
+             * single group, so that they all count over the same interval.
+             * Counters that cannot be opened (unsupported by the CPU, or
+             * forbidden by `perf_event_paranoid`) are left out, with a single
+             * warning per process, see `warning`. Elsewhere the group is
+             * always empty.
+             *
+             * Only user space events of the calling thread are counted.
+             */
+            class PerfCounterGroup : Catch::Detail::NonCopyable {
+            public:
+                explicit PerfCounterGroup( std::vector<std::string> const& names );
+                ~PerfCounterGroup();
+
+                bool empty() const { return m_counters.empty(); }
+                //! Why some of the counters are left out, empty if none
+                //! are or if another group already warned about it
+                std::string const& warning() const { return m_warning; }
+
+                void start();
+                //! Stops counting and adds the counts to the totals
+                void stop();
+                //! Stops counting until `resume`, within the same interval
+                void pause();
+                void resume();
+
+                /**
+                 * Returns the average counts per iteration over all measured
+                 * intervals, each of which ran `iterationsPerInterval`
+                 * iterations
+                 *
+                 * If both cycles and instructions were counted, the
+                 * instructions per cycle are reported as "ipc".
+                 */
+                std::vector<BenchmarkCounter>
+                perIteration( int iterationsPerInterval ) const;
+
+            private:
+                struct Counter {
+                    std::string name;
+                    int fd;
+                    double total;
+                };
+                std::vector<Counter> m_counters;
+                std::string m_warning;
+                std::vector<std::uint64_t> m_readBuffer;
+                std::uint64_t m_intervals = 0;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_PERF_COUNTERS_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_perf_counters.cpp (@wolfram77)
+#ifndef CATCH_PERF_COUNTERS_CPP_INCLUDED
+#define CATCH_PERF_COUNTERS_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_perf_counters.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <atomic>
+
+#if defined( CATCH_PLATFORM_LINUX )
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#    include <cstring>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            namespace {
+                struct KnownCounter {
+                    StringRef name;
+                    std::uint32_t type;
+                    std::uint64_t config;
+                };
+
+#if defined( CATCH_PLATFORM_LINUX )
+                constexpr std::uint64_t l1dReadMisses =
+                    PERF_COUNT_HW_CACHE_L1D |
+                    ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) |
+                    ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 );
+
+                constexpr KnownCounter knownCounters[] = {
+                    { "cycles"_sr, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                    { "instructions"_sr, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                    { "branches"_sr, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS },
+                    { "branch-misses"_sr, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+                    { "l1d-misses"_sr, PERF_TYPE_HW_CACHE, l1dReadMisses },
+                    // On most CPUs, the generic cache miss event counts
+                    // the misses of the last level cache
+                    { "llc-misses"_sr, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+                };
+
+                int openCounter( KnownCounter const& counter, int groupFd ) {
+                    perf_event_attr attr;
+                    std::memset( &attr, 0, sizeof( attr ) );
+                    attr.size = sizeof( attr );
+                    attr.type = counter.type;
+                    attr.config = counter.config;
+                    // Only the group leader is disabled, the other counters
+                    // are enabled and disabled together with it.
+                    attr.disabled = groupFd == -1 ? 1 : 0;
+                    // Counting kernel events needs privileges with the
+                    // default perf_event_paranoid, and we only care about
+                    // the benchmarked code anyway.
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    attr.read_format = PERF_FORMAT_GROUP |
+                                       PERF_FORMAT_TOTAL_TIME_ENABLED |
+                                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+                    return static_cast<int>( syscall(
+                        SYS_perf_event_open, &attr, 0, -1, groupFd, 0 ) );
+                }
+#else
+                // Names are still known, so that the same command line works
+                // everywhere, even though the counters are never available.
+                constexpr KnownCounter knownCounters[] = {
+                    { "cycles"_sr, 0, 0 },
+                    { "instructions"_sr, 0, 0 },
+                    { "branches"_sr, 0, 0 },
+                    { "branch-misses"_sr, 0, 0 },
+                    { "l1d-misses"_sr, 0, 0 },
+                    { "llc-misses"_sr, 0, 0 },
+                };
+#endif
+
+                KnownCounter const* findCounter( StringRef name ) {
+                    for ( auto const& counter : knownCounters ) {
+                        if ( counter.name == name ) {
+                            return &counter;
+                        }
+                    }
+                    return nullptr;
+                }
+
+                std::string unavailableCountersWarning( std::string const& names ) {
+                    // Every benchmark opens its own group, but one warning
+                    // per process is enough.
+                    static std::atomic<bool> warned{ false };
+                    if ( warned.exchange( true ) ) {
+                        return std::string();
+                    }
+#if defined( CATCH_PLATFORM_LINUX )
+                    return "Performance counters " + names +
+                           " are not available, check that the CPU supports"
+                           " them and that /proc/sys/kernel/perf_event_paranoid"
+                           " allows their use";
+#else
+                    return "Performance counters " + names +
+                           " are not available, they are supported only on"
+                           " Linux";
+#endif
+                }
+            } // end unnamed namespace
+
+            bool isKnownPerfCounter( StringRef name ) {
+                return findCounter( name ) != nullptr;
+            }
+
+            StringRef knownPerfCounterNames() {
+                return "cycles, instructions, branches, branch-misses, "
+                       "l1d-misses, llc-misses"_sr;
+            }
+
+            PerfCounterGroup::PerfCounterGroup(
+                std::vector<std::string> const& names ) {
+                std::string unavailable;
+                for ( auto const& name : names ) {
+                    auto const* counter = findCounter( name );
+#if defined( CATCH_PLATFORM_LINUX )
+                    const int groupFd =
+                        m_counters.empty() ? -1 : m_counters.front().fd;
+                    const int fd = counter ? openCounter( *counter, groupFd ) : -1;
+                    if ( fd >= 0 ) {
+                        m_counters.push_back( { name, fd, 0. } );
+                        continue;
+                    }
+#else
+                    static_cast<void>( counter );
+#endif
+                    unavailable += unavailable.empty() ? "" : ", ";
+                    unavailable += name;
+                }
+                if ( !unavailable.empty() ) {
+                    m_warning = unavailableCountersWarning( unavailable );
+                }
+                // nr, time enabled, time running, and then the values
+                m_readBuffer.resize( 3 + m_counters.size() );
+            }
+
+            PerfCounterGroup::~PerfCounterGroup() {
+#if defined( CATCH_PLATFORM_LINUX )
+                // Followers have to be closed before the leader
+                for ( auto it = m_counters.rbegin(); it != m_counters.rend(); ++it ) {
+                    close( it->fd );
+                }
+#endif
+            }
+
+            void PerfCounterGroup::start() {
+#if defined( CATCH_PLATFORM_LINUX )
+                if ( m_counters.empty() ) {
+                    return;
+                }
+                const int leader = m_counters.front().fd;
+                ioctl( leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP );
+                ioctl( leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+#endif
+            }
+
+            void PerfCounterGroup::stop() {
+#if defined( CATCH_PLATFORM_LINUX )
+                if ( m_counters.empty() ) {
+                    return;
+                }
+                const int leader = m_counters.front().fd;
+                ioctl( leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+
+                const auto bufferSize = m_readBuffer.size() * sizeof( std::uint64_t );
+                if ( read( leader, m_readBuffer.data(), bufferSize ) !=
+                     static_cast<ssize_t>( bufferSize ) ) {
+                    return;
+                }
+                const auto enabled = m_readBuffer[1];
+                const auto running = m_readBuffer[2];
+                if ( running == 0 ) {
+                    // The group did not get onto the PMU at all
+                    return;
+                }
+                // If other users of the PMU forced multiplexing, the counts
+                // are extrapolated to the whole interval.
+                const double scale = static_cast<double>( enabled ) /
+                                     static_cast<double>( running );
+                for ( std::size_t i = 0; i < m_counters.size(); ++i ) {
+                    m_counters[i].total +=
+                        static_cast<double>( m_readBuffer[3 + i] ) * scale;
+                }
+                ++m_intervals;
+#endif
+            }
+
+            void PerfCounterGroup::pause() {
+#if defined( CATCH_PLATFORM_LINUX )
+                if ( !m_counters.empty() ) {
+                    ioctl( m_counters.front().fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP );
+                }
+#endif
+            }
+
+            void PerfCounterGroup::resume() {
+#if defined( CATCH_PLATFORM_LINUX )
+                if ( !m_counters.empty() ) {
+                    ioctl( m_counters.front().fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP );
+                }
+#endif
+            }
+
+            std::vector<BenchmarkCounter>
+            PerfCounterGroup::perIteration( int iterationsPerInterval ) const {
+                std::vector<BenchmarkCounter> result;
+                if ( m_intervals == 0 || iterationsPerInterval <= 0 ) {
+                    return result;
+                }
+                const double iterations = static_cast<double>( m_intervals ) *
+                                          iterationsPerInterval;
+                double cycles = 0.;
+                double instructions = 0.;
+                for ( auto const& counter : m_counters ) {
+                    result.push_back( { counter.name, counter.total / iterations } );
+                    if ( counter.name == "cycles" ) {
+                        cycles = counter.total;
+                    } else if ( counter.name == "instructions" ) {
+                        instructions = counter.total;
+                    }
+                }
+                if ( cycles > 0. && instructions > 0. ) {
+                    result.push_back( { "ipc", instructions / cycles } );
+                }
+                return result;
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_PERF_COUNTERS_CPP_INCLUDED
+// END Amalgamated content from catch_perf_counters.cpp (@wolfram77)
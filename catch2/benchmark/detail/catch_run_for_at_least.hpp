@@ -31,7 +31,7 @@ namespace Catch {
                 Detail::ChronometerModel<Clock> meter;
                 auto&& result = Detail::complete_invoke(fun, Chronometer(meter, iters));
 
-                return { meter.elapsed(), CATCH_MOVE(result), iters };
+                return { std::chrono::duration_cast<IDuration>(meter.timed()), CATCH_MOVE(result), iters };
             }
 
             template <typename Clock, typename Fun>
@@ -12,6 +12,8 @@
 #include "../catch_estimate.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_outlier_classification.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Catch {
@@ -35,6 +37,29 @@ namespace Catch {
 
             double normal_quantile(double p);
 
+            /**
+             * Estimator with a fast way to compute its jackknife, the
+             * estimates with each of the samples left out
+             *
+             * The jackknife gives the acceleration of BCa bootstrap
+             * intervals. Without `jackknife`, it is computed by calling
+             * `estimate` for every left out sample, which is quadratic in
+             * the number of samples.
+             */
+            struct bootstrap_estimator {
+                double ( *estimate )( double const*, double const* );
+                //! Leave-one-out estimates, null if there is no shortcut
+                sample ( *jackknife )( double const*, double const* );
+            };
+
+            //! Mean, jackknifed in linear time from the sum of the samples
+            bootstrap_estimator mean_estimator();
+            //! Standard deviation, jackknifed in linear time from the sums
+            //! of the samples and of their squares
+            bootstrap_estimator standard_deviation_estimator();
+
+            //! BCa interval from the sorted resamples of an estimator that
+            //! is jackknifed by recomputing it, which reorders the samples
             Estimate<double>
             bootstrap( double confidence_level,
                        double* first,
@@ -42,16 +67,89 @@ namespace Catch {
                        sample const& resample,
                        double ( *estimator )( double const*, double const* ) );
 
+            //! BCa interval from resamples in any order, the bounds are
+            //! selected in linear time and the resamples are reordered
+            Estimate<double>
+            bootstrap( double confidence_level,
+                       double* first,
+                       double* last,
+                       sample& resample,
+                       bootstrap_estimator const& estimator );
+
             struct bootstrap_analysis {
                 Estimate<double> mean;
                 Estimate<double> standard_deviation;
                 double outlier_variance;
             };
 
+            /**
+             * Bootstraps mean and standard deviation of the samples
+             *
+             * The resampling is split between `n_threads` threads (0 means
+             * one per hardware thread). Results depend only on `seed`, not
+             * on the number of threads.
+             */
             bootstrap_analysis analyse_samples(double confidence_level,
                                                unsigned int n_resamples,
+                                               unsigned int n_threads,
+                                               std::uint32_t seed,
                                                double* first,
                                                double* last);
+
+            /**
+             * Bootstraps ratio of the mean of current samples to the mean
+             * of baseline samples
+             *
+             * The confidence interval is given by percentiles of the ratios
+             * of the resampled means, so ratio above 1 means slowdown.
+             */
+            Estimate<double> bootstrap_mean_ratio( double confidence_level,
+                                                   unsigned int n_resamples,
+                                                   std::uint32_t seed,
+                                                   double const* baseline_first,
+                                                   double const* baseline_last,
+                                                   double const* current_first,
+                                                   double const* current_last );
+
+            /**
+             * Estimates quantiles of the samples, e.g. 0.99 for p99
+             *
+             * Points interpolate between the two closest samples. Intervals
+             * are percentile bootstrap intervals of the order statistic at
+             * the quantile, which are computed exactly from the binomial
+             * distribution of its rank in the resamples rather than from
+             * random resamples.
+             */
+            std::vector<Estimate<double>>
+            bootstrap_quantiles( double confidence_level,
+                                 std::vector<double> const& quantiles,
+                                 double const* first,
+                                 double const* last );
+
+            /**
+             * Mean and variance of samples updated as they are taken
+             *
+             * Cheap enough to be updated after every sample, so that
+             * sampling can stop once the mean is known precisely enough.
+             */
+            struct running_mean {
+                void add( double x );
+
+                /**
+                 * Half-width of the confidence interval of the mean,
+                 * relative to the mean
+                 *
+                 * Uses the normal approximation rather than the bootstrap,
+                 * so it is only a stopping criterion, not the reported
+                 * interval. Infinite with fewer than two samples.
+                 */
+                double relative_half_width( double confidence_level ) const;
+
+                std::size_t count = 0;
+                double mean = 0.;
+                // Sum of squared differences from the mean
+                double m2 = 0.;
+            };
         } // namespace Detail
     } // namespace Benchmark
 } // namespace Catch
@@ -83,12 +181,15 @@ namespace Catch {
 #include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <limits>
 #include <numeric>
 #include <random>
 
 
 #if defined(CATCH_CONFIG_USE_ASYNC)
+#include <atomic>
 #include <future>
+#include <thread>
 #endif
 
 namespace Catch {
@@ -96,31 +197,54 @@ namespace Catch {
         namespace Detail {
             namespace {
 
-                template <typename URng, typename Estimator>
-                static sample
-                resample( URng& rng,
-                          unsigned int resamples,
-                          double const* first,
-                          double const* last,
-                          Estimator& estimator ) {
-                    auto n = static_cast<size_t>( last - first );
-                    Catch::uniform_integer_distribution<size_t> dist( 0, n - 1 );
-
-                    sample out;
-                    out.reserve( resamples );
-                    std::vector<double> resampled;
-                    resampled.reserve( n );
-                    for ( size_t i = 0; i < resamples; ++i ) {
-                        resampled.clear();
-                        for ( size_t s = 0; s < n; ++s ) {
-                            resampled.push_back( first[dist( rng )] );
+                // Resamples are generated in fixed-size blocks, each with its
+                // own RNG stream, so that the blocks can be processed by any
+                // number of threads with the same results.
+                constexpr std::size_t resample_block_size = 1024;
+
+                static std::uint32_t block_seed( std::uint32_t seed,
+                                                 std::size_t block ) {
+                    // SplitMix64 finalizer, to decorrelate the streams
+                    std::uint64_t z = seed + ( block + 1 ) * 0x9E3779B97F4A7C15ULL;
+                    z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ULL;
+                    z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBULL;
+                    return static_cast<std::uint32_t>( z ^ ( z >> 31 ) );
+                }
+
+                /**
+                 * Computes mean and standard deviation of the resamples in
+                 * given block, without materializing the resamples.
+                 *
+                 * The samples are shifted by `shift` (their mean) first, so
+                 * that the single pass variance does not lose precision.
+                 */
+                static void resample_block( std::uint32_t seed,
+                                            std::size_t block,
+                                            std::size_t n_resamples,
+                                            double const* first,
+                                            double const* last,
+                                            double shift,
+                                            double* means,
+                                            double* stddevs ) {
+                    const auto n = static_cast<std::size_t>( last - first );
+                    const auto n_double = static_cast<double>( n );
+                    Catch::uniform_integer_distribution<std::size_t> dist( 0, n - 1 );
+                    SimplePcg32 rng( block_seed( seed, block ) );
+
+                    const auto block_begin = block * resample_block_size;
+                    const auto block_end = (std::min)( block_begin + resample_block_size, n_resamples );
+                    for ( auto r = block_begin; r < block_end; ++r ) {
+                        double sum = 0.;
+                        double sum_squares = 0.;
+                        for ( std::size_t s = 0; s < n; ++s ) {
+                            const double d = first[dist( rng )] - shift;
+                            sum += d;
+                            sum_squares += d * d;
                         }
-                        const auto estimate =
-                            estimator( resampled.data(), resampled.data() + resampled.size() );
-                        out.push_back( estimate );
+                        const double m = sum / n_double;
+                        means[r] = shift + m;
+                        stddevs[r] = std::sqrt( (std::max)( sum_squares / n_double - m * m, 0. ) );
                     }
-                    std::sort( out.begin(), out.end() );
-                    return out;
                 }
 
                 static double outlier_variance( Estimate<double> mean,
@@ -263,6 +387,131 @@ namespace Catch {
                     return results;
                 }
 
+                static sample jackknife_mean( double const* first,
+                                              double const* last ) {
+                    const auto n = static_cast<double>( last - first );
+                    const double sum = std::accumulate( first, last, 0. );
+                    sample results;
+                    results.reserve( static_cast<size_t>( last - first ) );
+                    for ( ; first != last; ++first ) {
+                        results.push_back( ( sum - *first ) / ( n - 1. ) );
+                    }
+                    return results;
+                }
+
+                static sample
+                jackknife_standard_deviation( double const* first,
+                                              double const* last ) {
+                    // Shifted by the mean, so that the sums of squares do
+                    // not lose precision, like in `resample_block`
+                    const double shift = Catch::Benchmark::Detail::mean( first, last );
+                    const auto n = static_cast<double>( last - first );
+                    double sum = 0.;
+                    double sum_squares = 0.;
+                    for ( auto it = first; it != last; ++it ) {
+                        const double d = *it - shift;
+                        sum += d;
+                        sum_squares += d * d;
+                    }
+                    sample results;
+                    results.reserve( static_cast<size_t>( last - first ) );
+                    for ( ; first != last; ++first ) {
+                        const double d = *first - shift;
+                        const double m = ( sum - d ) / ( n - 1. );
+                        const double variance =
+                            ( sum_squares - d * d ) / ( n - 1. ) - m * m;
+                        results.push_back( std::sqrt( (std::max)( variance, 0. ) ) );
+                    }
+                    return results;
+                }
+
+                //! Probability that Binomial(n, p) is at least k
+                static double binomial_upper_tail( std::size_t n,
+                                                   double p,
+                                                   std::size_t k ) {
+                    if ( k == 0 || p >= 1. ) {
+                        return 1.;
+                    }
+                    if ( p <= 0. ) {
+                        return 0.;
+                    }
+                    const double n_double = static_cast<double>( n );
+                    const double log_p = std::log( p );
+                    const double log_q = std::log1p( -p );
+                    const double log_n_factorial = std::lgamma( n_double + 1. );
+                    double tail = 0.;
+                    for ( std::size_t i = k; i <= n; ++i ) {
+                        const double i_double = static_cast<double>( i );
+                        const double term = std::exp(
+                            log_n_factorial - std::lgamma( i_double + 1. ) -
+                            std::lgamma( n_double - i_double + 1. ) +
+                            i_double * log_p + ( n_double - i_double ) * log_q );
+                        tail += term;
+                        // Past the mode, the terms only get smaller
+                        if ( i_double > n_double * p && term < tail * 1e-17 ) {
+                            break;
+                        }
+                    }
+                    return (std::min)( tail, 1. );
+                }
+
+                //! Positions of the BCa bounds among the sorted resamples
+                struct bca_bounds {
+                    double point;
+                    //! Are all resamples at or above the point estimate?
+                    bool degenerate;
+                    std::size_t lo;
+                    std::size_t hi;
+                };
+
+                static bca_bounds bca( double confidence_level,
+                                       double point,
+                                       sample const& jack,
+                                       sample const& resample ) {
+                    double jack_mean =
+                        mean( jack.data(), jack.data() + jack.size() );
+                    double sum_squares = 0, sum_cubes = 0;
+                    for ( double x : jack ) {
+                        auto difference = jack_mean - x;
+                        auto square = difference * difference;
+                        auto cube = square * difference;
+                        sum_squares += square;
+                        sum_cubes += cube;
+                    }
+
+                    double accel = sum_cubes / ( 6 * std::pow( sum_squares, 1.5 ) );
+                    long n = static_cast<long>( resample.size() );
+                    double prob_n = static_cast<double>(
+                        std::count_if( resample.begin(),
+                                       resample.end(),
+                                       [point]( double x ) { return x < point; } )) /
+                        static_cast<double>( n );
+                    // degenerate case with uniform samples
+                    if ( Catch::Detail::directCompare( prob_n, 0. ) ) {
+                        return { point, true, 0, 0 };
+                    }
+
+                    double bias = normal_quantile( prob_n );
+                    double z1 = normal_quantile( ( 1. - confidence_level ) / 2. );
+
+                    auto cumn = [n]( double x ) -> long {
+                        return std::lround( normal_cdf( x ) *
+                                            static_cast<double>( n ) );
+                    };
+                    auto a = [bias, accel]( double b ) {
+                        return bias + b / ( 1. - accel * b );
+                    };
+                    double b1 = bias + z1;
+                    double b2 = bias - z1;
+                    double a1 = a( b1 );
+                    double a2 = a( b2 );
+                    auto lo = static_cast<size_t>( (std::max)( cumn( a1 ), 0l ) );
+                    auto hi =
+                        static_cast<size_t>( (std::min)( cumn( a2 ), n - 1 ) );
+
+                    return { point, false, lo, hi };
+                }
+
 
             } // namespace
         }     // namespace Detail
@@ -354,6 +603,14 @@ namespace Catch {
                 return result;
             }
 
+            bootstrap_estimator mean_estimator() {
+                return { &Detail::mean, &jackknife_mean };
+            }
+
+            bootstrap_estimator standard_deviation_estimator() {
+                return { &standard_deviation, &jackknife_standard_deviation };
+            }
+
             Estimate<double>
             bootstrap( double confidence_level,
                        double* first,
@@ -368,91 +625,216 @@ namespace Catch {
                     return { point, point, point, confidence_level };
 
                 sample jack = jackknife( estimator, first, last );
-                double jack_mean =
-                    mean( jack.data(), jack.data() + jack.size() );
-                double sum_squares = 0, sum_cubes = 0;
-                for ( double x : jack ) {
-                    auto difference = jack_mean - x;
-                    auto square = difference * difference;
-                    auto cube = square * difference;
-                    sum_squares += square;
-                    sum_cubes += cube;
+                const auto bounds = bca( confidence_level, point, jack, resample );
+                if ( bounds.degenerate ) {
+                    return { point, point, point, confidence_level };
                 }
+                return { point, resample[bounds.lo], resample[bounds.hi], confidence_level };
+            }
 
-                double accel = sum_cubes / ( 6 * std::pow( sum_squares, 1.5 ) );
-                long n = static_cast<long>( resample.size() );
-                double prob_n = static_cast<double>(
-                    std::count_if( resample.begin(),
-                                   resample.end(),
-                                   [point]( double x ) { return x < point; } )) /
-                    static_cast<double>( n );
-                // degenerate case with uniform samples
-                if ( Catch::Detail::directCompare( prob_n, 0. ) ) {
-                    return { point, point, point, confidence_level };
+            Estimate<double>
+            bootstrap( double confidence_level,
+                       double* first,
+                       double* last,
+                       sample& resample,
+                       bootstrap_estimator const& estimator ) {
+                if ( !estimator.jackknife ) {
+                    std::sort( resample.begin(), resample.end() );
+                    return bootstrap( confidence_level, first, last, resample, estimator.estimate );
                 }
 
-                double bias = normal_quantile( prob_n );
-                double z1 = normal_quantile( ( 1. - confidence_level ) / 2. );
+                double point = estimator.estimate( first, last );
+                // Degenerate case with a single sample
+                if ( last - first == 1 )
+                    return { point, point, point, confidence_level };
 
-                auto cumn = [n]( double x ) -> long {
-                    return std::lround( normal_cdf( x ) *
-                                        static_cast<double>( n ) );
-                };
-                auto a = [bias, accel]( double b ) {
-                    return bias + b / ( 1. - accel * b );
-                };
-                double b1 = bias + z1;
-                double b2 = bias - z1;
-                double a1 = a( b1 );
-                double a2 = a( b2 );
-                auto lo = static_cast<size_t>( (std::max)( cumn( a1 ), 0l ) );
-                auto hi =
-                    static_cast<size_t>( (std::min)( cumn( a2 ), n - 1 ) );
-
-                return { point, resample[lo], resample[hi], confidence_level };
+                sample jack = estimator.jackknife( first, last );
+                const auto bounds = bca( confidence_level, point, jack, resample );
+                if ( bounds.degenerate ) {
+                    return { point, point, point, confidence_level };
+                }
+                // Only the two bounds are needed, so selecting them is
+                // enough, the upper one first so the lower one is selected
+                // from the part before it
+                const auto hi = resample.begin() + static_cast<std::ptrdiff_t>( bounds.hi );
+                std::nth_element( resample.begin(), hi, resample.end() );
+                const auto lo = resample.begin() + static_cast<std::ptrdiff_t>( bounds.lo );
+                std::nth_element( resample.begin(), lo, hi );
+                return { point, *lo, *hi, confidence_level };
             }
 
             bootstrap_analysis analyse_samples(double confidence_level,
                                                unsigned int n_resamples,
+                                               unsigned int n_threads,
+                                               std::uint32_t seed,
                                                double* first,
                                                double* last) {
-                auto mean = &Detail::mean;
-                auto stddev = &standard_deviation;
+                sample means( n_resamples );
+                sample stddevs( n_resamples );
+                const double shift = Detail::mean( first, last );
+                const std::size_t n_blocks =
+                    ( n_resamples + resample_block_size - 1 ) / resample_block_size;
+                auto run_block = [&]( std::size_t block ) {
+                    resample_block( seed, block, n_resamples, first, last, shift,
+                                    means.data(), stddevs.data() );
+                };
 
 #if defined(CATCH_CONFIG_USE_ASYNC)
-                auto Estimate = [=](double(*f)(double const*, double const*)) {
-                    std::random_device rd;
-                    auto seed = rd();
-                    return std::async(std::launch::async, [=] {
-                        SimplePcg32 rng( seed );
-                        auto resampled = resample(rng, n_resamples, first, last, f);
-                        return bootstrap(confidence_level, first, last, resampled, f);
-                    });
+                std::size_t n_workers = n_threads > 0
+                    ? n_threads
+                    : (std::max)( std::thread::hardware_concurrency(), 1u );
+                n_workers = (std::min)( n_workers, n_blocks );
+
+                std::atomic<std::size_t> next_block{ 0 };
+                auto run_blocks = [&] {
+                    for ( auto block = next_block++; block < n_blocks; block = next_block++ ) {
+                        run_block( block );
+                    }
                 };
-
-                auto mean_future = Estimate(mean);
-                auto stddev_future = Estimate(stddev);
-
-                auto mean_estimate = mean_future.get();
-                auto stddev_estimate = stddev_future.get();
+                std::vector<std::future<void>> workers;
+                for ( std::size_t i = 1; i < n_workers; ++i ) {
+                    workers.push_back( std::async( std::launch::async, run_blocks ) );
+                }
+                run_blocks();
+                for ( auto& worker : workers ) {
+                    worker.get();
+                }
 #else
-                auto Estimate = [=](double(*f)(double const* , double const*)) {
-                    std::random_device rd;
-                    auto seed = rd();
-                    SimplePcg32 rng( seed );
-                    auto resampled = resample(rng, n_resamples, first, last, f);
-                    return bootstrap(confidence_level, first, last, resampled, f);
-                };
-
-                auto mean_estimate = Estimate(mean);
-                auto stddev_estimate = Estimate(stddev);
+                static_cast<void>( n_threads );
+                for ( std::size_t block = 0; block < n_blocks; ++block ) {
+                    run_block( block );
+                }
 #endif // CATCH_USE_ASYNC
 
+                auto mean_estimate = bootstrap( confidence_level, first, last, means, mean_estimator() );
+                auto stddev_estimate = bootstrap( confidence_level, first, last, stddevs, standard_deviation_estimator() );
+
                 auto n = static_cast<int>(last - first); // seriously, one can't use integral types without hell in C++
                 double outlier_variance = Detail::outlier_variance(mean_estimate, stddev_estimate, n);
 
                 return { mean_estimate, stddev_estimate, outlier_variance };
             }
+
+            Estimate<double> bootstrap_mean_ratio( double confidence_level,
+                                                   unsigned int n_resamples,
+                                                   std::uint32_t seed,
+                                                   double const* baseline_first,
+                                                   double const* baseline_last,
+                                                   double const* current_first,
+                                                   double const* current_last ) {
+                auto ratio = []( double current, double baseline ) {
+                    if ( baseline > 0. ) {
+                        return current / baseline;
+                    }
+                    // Too fast to measure in baseline, any time is slowdown
+                    return current > 0. ? std::numeric_limits<double>::infinity() : 1.;
+                };
+                const double point = ratio( Detail::mean( current_first, current_last ),
+                                            Detail::mean( baseline_first, baseline_last ) );
+                if ( n_resamples == 0 ) {
+                    return { point, point, point, confidence_level };
+                }
+
+                const auto n_baseline = static_cast<std::size_t>( baseline_last - baseline_first );
+                const auto n_current = static_cast<std::size_t>( current_last - current_first );
+                Catch::uniform_integer_distribution<std::size_t> baseline_dist( 0, n_baseline - 1 );
+                Catch::uniform_integer_distribution<std::size_t> current_dist( 0, n_current - 1 );
+                SimplePcg32 rng( seed );
+
+                sample ratios( n_resamples );
+                for ( auto& resampled_ratio : ratios ) {
+                    double baseline_sum = 0.;
+                    for ( std::size_t i = 0; i < n_baseline; ++i ) {
+                        baseline_sum += baseline_first[baseline_dist( rng )];
+                    }
+                    double current_sum = 0.;
+                    for ( std::size_t i = 0; i < n_current; ++i ) {
+                        current_sum += current_first[current_dist( rng )];
+                    }
+                    resampled_ratio = ratio( current_sum / static_cast<double>( n_current ),
+                                             baseline_sum / static_cast<double>( n_baseline ) );
+                }
+
+                const double tail = ( 1. - confidence_level ) / 2.;
+                const auto last_index = static_cast<double>( n_resamples - 1 );
+                const auto lo = ratios.begin() + static_cast<std::ptrdiff_t>( std::floor( tail * last_index ) );
+                const auto hi = ratios.begin() + static_cast<std::ptrdiff_t>( std::ceil( ( 1. - tail ) * last_index ) );
+                std::nth_element( ratios.begin(), hi, ratios.end() );
+                std::nth_element( ratios.begin(), lo, hi );
+                return { point, *lo, *hi, confidence_level };
+            }
+
+            std::vector<Estimate<double>>
+            bootstrap_quantiles( double confidence_level,
+                                 std::vector<double> const& quantiles,
+                                 double const* first,
+                                 double const* last ) {
+                sample sorted( first, last );
+                std::sort( sorted.begin(), sorted.end() );
+                const auto n = sorted.size();
+                const double tail = ( 1. - confidence_level ) / 2.;
+
+                std::vector<Estimate<double>> estimates;
+                estimates.reserve( quantiles.size() );
+                for ( const double q : quantiles ) {
+                    const double idx = q * static_cast<double>( n - 1 );
+                    const auto j = static_cast<std::size_t>( idx );
+                    const double point =
+                        j + 1 < n ? sorted[j] + ( idx - static_cast<double>( j ) ) *
+                                                    ( sorted[j + 1] - sorted[j] )
+                                  : sorted[j];
+
+                    // The k-th smallest resampled value is at most the j-th
+                    // smallest sample iff at least k of the n draws are
+                    // among the j smallest samples
+                    const auto k = static_cast<std::size_t>( (std::min)(
+                        (std::max)( std::ceil( q * static_cast<double>( n ) ), 1. ),
+                        static_cast<double>( n ) ) );
+                    auto bound = [&]( double probability ) {
+                        std::size_t lo = 1, hi = n;
+                        while ( lo < hi ) {
+                            const auto mid = lo + ( hi - lo ) / 2;
+                            const double p = static_cast<double>( mid ) /
+                                             static_cast<double>( n );
+                            if ( binomial_upper_tail( n, p, k ) >= probability ) {
+                                hi = mid;
+                            } else {
+                                lo = mid + 1;
+                            }
+                        }
+                        return sorted[lo - 1];
+                    };
+                    estimates.push_back( { point,
+                                           (std::min)( bound( tail ), point ),
+                                           (std::max)( bound( 1. - tail ), point ),
+                                           confidence_level } );
+                }
+                return estimates;
+            }
+
+            void running_mean::add( double x ) {
+                // Welford's algorithm, stable even for many similar samples
+                ++count;
+                const double delta = x - mean;
+                mean += delta / static_cast<double>( count );
+                m2 += delta * ( x - mean );
+            }
+
+            double running_mean::relative_half_width( double confidence_level ) const {
+                if ( count < 2 ) {
+                    return std::numeric_limits<double>::infinity();
+                }
+                const double n = static_cast<double>( count );
+                const double standard_error = std::sqrt( m2 / ( n - 1. ) / n );
+                const double z =
+                    normal_quantile( 1. - ( 1. - confidence_level ) / 2. );
+                if ( !( mean > 0. ) ) {
+                    return standard_error > 0.
+                               ? std::numeric_limits<double>::infinity()
+                               : 0.;
+                }
+                return z * standard_error / mean;
+            }
         } // namespace Detail
     } // namespace Benchmark
 } // namespace Catch
@@ -0,0 +1,294 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_THREAD_TEAM_HPP_INCLUDED
+#define CATCH_THREAD_TEAM_HPP_INCLUDED
+
+#include "../catch_chronometer.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_optimizer.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_meta.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <type_traits>
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+#    include <atomic>
+#    include <condition_variable>
+#    include <cstdint>
+#    include <exception>
+#    include <mutex>
+#    include <thread>
+#    include <vector>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Code run by every thread of `ThreadTeam`
+            struct ThreadTeamBody {
+                //! Runs `iterations` iterations on the thread with given index
+                virtual void run( int threadIndex, int iterations ) = 0;
+                virtual ~ThreadTeamBody(); // = default
+
+                ThreadTeamBody() = default;
+                ThreadTeamBody( ThreadTeamBody const& ) = default;
+                ThreadTeamBody& operator=( ThreadTeamBody const& ) = default;
+            };
+
+            //! The iteration loop lives here, so that the body is not
+            //! called through a virtual function in every iteration
+            template <typename Fun>
+            struct ThreadTeamBodyModel final : public ThreadTeamBody {
+                ThreadTeamBodyModel( Fun&& fun_ ): fun( CATCH_MOVE( fun_ ) ) {}
+
+                void run( int threadIndex, int iterations ) override {
+                    run( threadIndex, iterations, is_callable<Fun( int )>() );
+                }
+                void run( int threadIndex, int iterations, std::true_type ) {
+                    for ( int i = 0; i < iterations; ++i ) {
+                        invoke_deoptimized( fun, threadIndex );
+                    }
+                }
+                void run( int, int iterations, std::false_type ) {
+                    for ( int i = 0; i < iterations; ++i ) {
+                        invoke_deoptimized( fun );
+                    }
+                }
+
+                Fun fun;
+            };
+
+            /**
+             * Threads running a benchmark body concurrently
+             *
+             * The calling thread is thread 0, the others are started once
+             * and reused for all measurements. Before every measurement,
+             * the other threads are woken up and spin on a barrier, which
+             * the calling thread opens right after starting the clock.
+             * The clock stops when the last thread is done, so every
+             * measurement times all threads running the same number of
+             * iterations.
+             *
+             * An exception thrown by the body on any thread, e.g. by
+             * a failed `REQUIRE`, is rethrown from `measure` once all
+             * threads are done.
+             *
+             * The other threads do not inherit the pin of `--benchmark-cpu`,
+             * they run with the affinity the calling thread had before it,
+             * so that the team is not squeezed onto a single CPU.
+             *
+             * Without `CATCH_CONFIG_USE_ASYNC`, only teams of a single
+             * thread can be created.
+             */
+            class ThreadTeam : Catch::Detail::NonCopyable {
+            public:
+                ThreadTeam( int threads, ThreadTeamBody& body );
+                ~ThreadTeam();
+
+                //! Runs `meter.runs()` iterations on every thread
+                void measure( Chronometer meter );
+
+            private:
+                ThreadTeamBody& m_body;
+#if defined( CATCH_CONFIG_USE_ASYNC )
+                void work( int threadIndex );
+
+                std::vector<std::thread> m_workers;
+                std::mutex m_mutex;
+                std::condition_variable m_armed;
+                std::uint64_t m_armedMeasurement = 0;
+                bool m_stopping = false;
+                int m_iterations = 0;
+                //! First exception thrown by a worker during a measurement
+                std::exception_ptr m_failure;
+                std::atomic<std::uint64_t> m_startedMeasurement{ 0 };
+                std::atomic<int> m_waitingWorkers{ 0 };
+                std::atomic<int> m_finishedWorkers{ 0 };
+#endif
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_THREAD_TEAM_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_thread_team.cpp (@wolfram77)
+#ifndef CATCH_THREAD_TEAM_CPP_INCLUDED
+#define CATCH_THREAD_TEAM_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_thread_team.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            ThreadTeamBody::~ThreadTeamBody() = default;
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+            ThreadTeam::ThreadTeam( int threads, ThreadTeamBody& body ):
+                m_body( body ) {
+                CATCH_ENFORCE( threads > 0,
+                               "Benchmark thread count must be positive" );
+                m_workers.reserve( static_cast<std::size_t>( threads - 1 ) );
+                // New threads inherit the affinity of this one, which may
+                // be pinned to the benchmark CPU
+                const CpuAffinity affinity = unpinnedAffinity();
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+                // Assertions in the body go to the test case that runs
+                // the benchmark, whichever thread checks them
+                IResultCapture* const capture =
+                    getCurrentContext().getResultCapture();
+                for ( int i = 1; i < threads; ++i ) {
+                    m_workers.emplace_back( [this, i, affinity, capture] {
+                        affinity.apply();
+                        ThreadResultCaptureScope scope( capture );
+                        work( i );
+                    } );
+                }
+#else
+                for ( int i = 1; i < threads; ++i ) {
+                    m_workers.emplace_back( [this, i, affinity] {
+                        affinity.apply();
+                        work( i );
+                    } );
+                }
+#endif
+            }
+
+            ThreadTeam::~ThreadTeam() {
+                {
+                    std::lock_guard<std::mutex> lock( m_mutex );
+                    m_stopping = true;
+                }
+                m_armed.notify_all();
+                for ( auto& worker : m_workers ) {
+                    worker.join();
+                }
+            }
+
+            void ThreadTeam::measure( Chronometer meter ) {
+                const int workers = static_cast<int>( m_workers.size() );
+                std::uint64_t measurement;
+                {
+                    std::lock_guard<std::mutex> lock( m_mutex );
+                    m_iterations = meter.runs();
+                    m_waitingWorkers.store( 0, std::memory_order_relaxed );
+                    m_finishedWorkers.store( 0, std::memory_order_relaxed );
+                    measurement = ++m_armedMeasurement;
+                }
+                m_armed.notify_all();
+                // Waking the workers up must not be part of the measurement
+                while ( m_waitingWorkers.load( std::memory_order_acquire ) !=
+                        workers ) {
+                    std::this_thread::yield();
+                }
+
+                optimizer_barrier();
+                meter.impl->start();
+                m_startedMeasurement.store( measurement, std::memory_order_release );
+                std::exception_ptr failure;
+                CATCH_TRY {
+                    m_body.run( 0, meter.runs() );
+                } CATCH_CATCH_ALL {
+                    failure = std::current_exception();
+                }
+                // The other threads still use the body, so they have to
+                // finish even if this one failed
+                while ( m_finishedWorkers.load( std::memory_order_acquire ) !=
+                        workers ) {
+                    std::this_thread::yield();
+                }
+                meter.impl->finish();
+                optimizer_barrier();
+
+                {
+                    std::lock_guard<std::mutex> lock( m_mutex );
+                    if ( !failure ) {
+                        failure = m_failure;
+                    }
+                    m_failure = nullptr;
+                }
+                if ( failure ) {
+                    std::rethrow_exception( failure );
+                }
+            }
+
+            void ThreadTeam::work( int threadIndex ) {
+                std::uint64_t measurement = 0;
+                for ( ;; ) {
+                    int iterations;
+                    {
+                        std::unique_lock<std::mutex> lock( m_mutex );
+                        m_armed.wait( lock, [&] {
+                            return m_stopping ||
+                                   m_armedMeasurement != measurement;
+                        } );
+                        if ( m_stopping ) {
+                            return;
+                        }
+                        measurement = m_armedMeasurement;
+                        iterations = m_iterations;
+                    }
+                    // Sleeping on the condition variable would delay the
+                    // start by the wake up latency, so spin on the barrier
+                    m_waitingWorkers.fetch_add( 1, std::memory_order_release );
+                    while ( m_startedMeasurement.load( std::memory_order_acquire ) !=
+                            measurement ) {
+                        std::this_thread::yield();
+                    }
+                    // An exception escaping the thread would terminate
+                    // the process, so it is handed to `measure`
+                    CATCH_TRY {
+                        m_body.run( threadIndex, iterations );
+                    } CATCH_CATCH_ALL {
+                        std::lock_guard<std::mutex> lock( m_mutex );
+                        if ( !m_failure ) {
+                            m_failure = std::current_exception();
+                        }
+                    }
+                    m_finishedWorkers.fetch_add( 1, std::memory_order_release );
+                }
+            }
+#else
+            ThreadTeam::ThreadTeam( int threads, ThreadTeamBody& body ):
+                m_body( body ) {
+                CATCH_ENFORCE( threads == 1,
+                               "Benchmarks with more than one thread need "
+                               "CATCH_CONFIG_USE_ASYNC" );
+            }
+
+            ThreadTeam::~ThreadTeam() = default;
+
+            void ThreadTeam::measure( Chronometer meter ) {
+                optimizer_barrier();
+                meter.impl->start();
+                m_body.run( 0, meter.runs() );
+                meter.impl->finish();
+                optimizer_barrier();
+            }
+#endif
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_THREAD_TEAM_CPP_INCLUDED
+// END Amalgamated content from catch_thread_team.cpp (@wolfram77)
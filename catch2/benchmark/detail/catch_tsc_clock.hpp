@@ -0,0 +1,210 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_TSC_CLOCK_HPP_INCLUDED
+#define CATCH_TSC_CLOCK_HPP_INCLUDED
+
+#include "../catch_clock.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <chrono>
+#include <cstdint>
+
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || \
+    ( defined( _M_IX86 ) && !defined( _M_ARM64EC ) )
+#    define CATCH_INTERNAL_BENCHMARK_HAS_TSC
+#    if defined( _MSC_VER ) && !defined( __clang__ )
+#        include <intrin.h>
+#    else
+#        include <x86intrin.h>
+#    endif
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+
+            //! Length of a TSC tick, set by `tsc_clock::is_available`
+            extern double tscNanosecondsPerTick;
+
+            //! Reads the time stamp counter, 0 if there is none
+            inline std::uint64_t readTsc() noexcept {
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_TSC )
+                // rdtscp waits for the preceding instructions to finish,
+                // the fence keeps the following ones from starting early
+                unsigned int aux;
+                const std::uint64_t ticks = __rdtscp( &aux );
+                _mm_lfence();
+                return ticks;
+#else
+                return 0;
+#endif
+            }
+
+            /**
+             * Clock reading the time stamp counter of x86 CPUs
+             *
+             * Reading it takes a few nanoseconds, against tens for
+             * `steady_clock` on some virtual machines, which matters for
+             * benchmarks of very short operations.
+             *
+             * The tick rate is measured against `steady_clock` once, by the
+             * first call to `is_available`. It returns false if the CPU
+             * has no invariant TSC, which keeps ticking at the same rate
+             * regardless of frequency scaling and sleep states, or is not
+             * x86. `now()` must not be used then.
+             */
+            struct tsc_clock {
+                // Whole nanoseconds, like the timings of the other clocks
+                using duration = IDuration;
+                using rep = duration::rep;
+                using period = duration::period;
+                using time_point = std::chrono::time_point<tsc_clock, duration>;
+                static constexpr bool is_steady = true;
+
+                static time_point now() noexcept {
+                    return time_point( duration( static_cast<rep>(
+                        static_cast<double>( readTsc() ) * tscNanosecondsPerTick ) ) );
+                }
+
+                static bool is_available();
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_TSC_CLOCK_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_tsc_clock.cpp (@wolfram77)
+#ifndef CATCH_TSC_CLOCK_CPP_INCLUDED
+#define CATCH_TSC_CLOCK_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_tsc_clock.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <sstream>
+#include <string>
+
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_TSC ) && \
+    !( defined( _MSC_VER ) && !defined( __clang__ ) )
+#    include <cpuid.h>
+#endif
+
+namespace Catch {
+    namespace Benchmark {
+        namespace Detail {
+            double tscNanosecondsPerTick = 0.;
+
+            namespace {
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_TSC )
+                // Long enough for the error of reading both clocks to be
+                // in the parts per million
+                constexpr auto tscCalibrationTime = std::chrono::milliseconds( 20 );
+
+                //! EDX of the extended cpuid leaf, 0 if it is not supported
+                std::uint32_t extendedCpuidEdx( std::uint32_t leaf ) {
+#    if defined( _MSC_VER ) && !defined( __clang__ )
+                    int registers[4] = {};
+                    __cpuid( registers, static_cast<int>( 0x80000000u ) );
+                    if ( static_cast<std::uint32_t>( registers[0] ) < leaf ) {
+                        return 0;
+                    }
+                    __cpuid( registers, static_cast<int>( leaf ) );
+                    return static_cast<std::uint32_t>( registers[3] );
+#    else
+                    unsigned int eax, ebx, ecx, edx;
+                    if ( !__get_cpuid( leaf, &eax, &ebx, &ecx, &edx ) ) {
+                        return 0;
+                    }
+                    return edx;
+#    endif
+                }
+
+                //! Hypervisors may hide the cpuid bit while the kernel
+                //! knows the TSC to be invariant
+                bool kernelReportsInvariantTsc() {
+#    if defined( CATCH_PLATFORM_LINUX )
+                    std::string cpuinfo;
+                    if ( !Catch::Detail::readWholeFile( "/proc/cpuinfo", cpuinfo ) ) {
+                        return false;
+                    }
+                    std::istringstream in( cpuinfo );
+                    std::string line;
+                    while ( std::getline( in, line ) ) {
+                        if ( line.compare( 0, 5, "flags" ) != 0 ) {
+                            continue;
+                        }
+                        std::istringstream flags( line.substr( line.find( ':' ) + 1 ) );
+                        bool constantTsc = false, nonstopTsc = false;
+                        std::string flag;
+                        while ( flags >> flag ) {
+                            constantTsc = constantTsc || flag == "constant_tsc";
+                            nonstopTsc = nonstopTsc || flag == "nonstop_tsc";
+                        }
+                        return constantTsc && nonstopTsc;
+                    }
+#    endif
+                    return false;
+                }
+
+                bool hasInvariantTsc() {
+                    // RDTSCP is bit 27 of 0x80000001, invariant TSC is
+                    // bit 8 of 0x80000007
+                    if ( !( extendedCpuidEdx( 0x80000001u ) & ( 1u << 27 ) ) ) {
+                        return false;
+                    }
+                    return ( extendedCpuidEdx( 0x80000007u ) & ( 1u << 8 ) ) ||
+                           kernelReportsInvariantTsc();
+                }
+
+                double measureNanosecondsPerTick() {
+                    using steady = std::chrono::steady_clock;
+                    const auto startTime = steady::now();
+                    const auto startTicks = readTsc();
+                    auto endTime = startTime;
+                    while ( endTime - startTime < tscCalibrationTime ) {
+                        endTime = steady::now();
+                    }
+                    const auto endTicks = readTsc();
+                    if ( endTicks <= startTicks ) {
+                        return 0.;
+                    }
+                    return std::chrono::duration_cast<FDuration>( endTime - startTime ).count() /
+                           static_cast<double>( endTicks - startTicks );
+                }
+#endif
+            } // end unnamed namespace
+
+            bool tsc_clock::is_available() {
+#if defined( CATCH_INTERNAL_BENCHMARK_HAS_TSC )
+                static const bool available = [] {
+                    if ( !hasInvariantTsc() ) {
+                        return false;
+                    }
+                    tscNanosecondsPerTick = measureNanosecondsPerTick();
+                    return tscNanosecondsPerTick > 0.;
+                }();
+                return available;
+#else
+                return false;
+#endif
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_TSC_CLOCK_CPP_INCLUDED
+// END Amalgamated content from catch_tsc_clock.cpp (@wolfram77)
@@ -0,0 +1,172 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_USER_COUNTERS_HPP_INCLUDED
+#define CATCH_USER_COUNTERS_HPP_INCLUDED
+
+#include "catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Catch {
+    namespace Benchmark {
+
+        //! "sum", "average" or "rate"
+        StringRef counterModeName( CounterMode mode );
+
+        namespace Detail {
+
+            /**
+             * Collects throughput and counters reported by the benchmark
+             * while its samples are taken
+             *
+             * Reports made during the estimation and warmup runs never get
+             * here, so the counters cover exactly the sampled iterations.
+             */
+            class UserCounters {
+            public:
+                void setBytesProcessed( std::uint64_t bytesPerIteration ) {
+                    m_bytesPerIteration = bytesPerIteration;
+                }
+                void setItemsProcessed( std::uint64_t itemsPerIteration ) {
+                    m_itemsPerIteration = itemsPerIteration;
+                }
+                //! Throws if the counter was reported with another mode
+                void add( std::string const& name, double value, CounterMode mode );
+
+                //! Called after every sample of `iterations` iterations
+                void sampleTaken( int iterations ) {
+                    m_iterations += static_cast<std::uint64_t>( iterations );
+                }
+
+                //! Fills the throughput and user counters of the stats,
+                //! rates are relative to their mean
+                void report( BenchmarkStats<>& stats ) const;
+
+            private:
+                struct Counter {
+                    std::string name;
+                    CounterMode mode;
+                    double total;
+                    std::uint64_t reports;
+                };
+                // Few counters per benchmark, kept in the order of the
+                // first report
+                std::vector<Counter> m_counters;
+                Optional<std::uint64_t> m_bytesPerIteration;
+                Optional<std::uint64_t> m_itemsPerIteration;
+                std::uint64_t m_iterations = 0;
+            };
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+
+#endif // CATCH_USER_COUNTERS_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_user_counters.cpp (@wolfram77)
+#ifndef CATCH_USER_COUNTERS_CPP_INCLUDED
+#define CATCH_USER_COUNTERS_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_user_counters.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../../internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+
+namespace Catch {
+    namespace Benchmark {
+
+        StringRef counterModeName( CounterMode mode ) {
+            switch ( mode ) {
+            case CounterMode::Sum:
+                return "sum"_sr;
+            case CounterMode::Average:
+                return "average"_sr;
+            case CounterMode::Rate:
+                return "rate"_sr;
+            }
+            CATCH_INTERNAL_ERROR( "Unknown counter mode" );
+        }
+
+        namespace Detail {
+
+            void UserCounters::add( std::string const& name,
+                                    double value,
+                                    CounterMode mode ) {
+                for ( auto& counter : m_counters ) {
+                    if ( counter.name == name ) {
+                        CATCH_ENFORCE( counter.mode == mode,
+                                       "Benchmark counter '"
+                                           << name
+                                           << "' reported with different modes" );
+                        counter.total += value;
+                        ++counter.reports;
+                        return;
+                    }
+                }
+                m_counters.push_back( { name, mode, value, 1 } );
+            }
+
+            void UserCounters::report( BenchmarkStats<>& stats ) const {
+                if ( m_iterations == 0 ) {
+                    return;
+                }
+                const double iterations = static_cast<double>( m_iterations );
+                const double secondsPerIteration = stats.mean.point.count() * 1e-9;
+                auto perSecond = [&]( double perIteration ) -> Optional<double> {
+                    if ( !( secondsPerIteration > 0. ) ) {
+                        return {};
+                    }
+                    return perIteration / secondsPerIteration;
+                };
+
+                if ( m_bytesPerIteration ) {
+                    stats.bytesPerSecond =
+                        perSecond( static_cast<double>( *m_bytesPerIteration ) );
+                }
+                if ( m_itemsPerIteration ) {
+                    stats.itemsPerSecond =
+                        perSecond( static_cast<double>( *m_itemsPerIteration ) );
+                }
+                for ( auto const& counter : m_counters ) {
+                    double value = 0.;
+                    switch ( counter.mode ) {
+                    case CounterMode::Sum:
+                        value = counter.total / iterations;
+                        break;
+                    case CounterMode::Average:
+                        value = counter.total /
+                                static_cast<double>( counter.reports );
+                        break;
+                    case CounterMode::Rate: {
+                        auto rate = perSecond( counter.total / iterations );
+                        if ( !rate ) {
+                            continue;
+                        }
+                        value = *rate;
+                        break;
+                    }
+                    }
+                    stats.userCounters.push_back( { counter.name, value, counter.mode } );
+                }
+            }
+
+        } // namespace Detail
+    } // namespace Benchmark
+} // namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_USER_COUNTERS_CPP_INCLUDED
+// END Amalgamated content from catch_user_counters.cpp (@wolfram77)
@@ -69,6 +69,7 @@
 #include "internal/catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_enum_values_registry.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_errno_guard.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_event_recorder.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_exception_translator_registry.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_fatal_condition_handler.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_floating_point_helpers.hpp"  // Adjust to relative path (@wolfram77)
@@ -88,6 +89,7 @@
 #include "internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_output_redirect.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_parse_numbers.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_polyfills.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_preprocessor.hpp"  // Adjust to relative path (@wolfram77)
@@ -102,6 +104,7 @@
 #include "internal/catch_result_type.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_reusable_string_stream.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_run_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_run_history.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_section.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_sharding.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_singletons.hpp"  // Adjust to relative path (@wolfram77)
@@ -119,7 +122,10 @@
 #include "internal/catch_test_failure_exception.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_test_macro_impl.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_test_registry.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_test_result_cache.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_test_spec_parser.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_test_timings.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_test_watchdog.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_textflow.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_thread_local.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_thread_support.hpp"  // Adjust to relative path (@wolfram77)
@@ -132,6 +138,8 @@
 #include "internal/catch_unreachable.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_void_type.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_wildcard_pattern.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_worker_processes.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_worker_threads.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_xmlwriter.hpp"  // Adjust to relative path (@wolfram77)
 #include "matchers/catch_matchers_all.hpp"  // Adjust to relative path (@wolfram77)
 #include "reporters/catch_reporters_all.hpp"  // Adjust to relative path (@wolfram77)
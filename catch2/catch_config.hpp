@@ -16,6 +16,7 @@
 #include "internal/catch_reporter_spec_parser.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <chrono>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -42,6 +43,14 @@ namespace Catch {
         }
     };
 
+    //! How test cases are run when running more than one job
+    enum class JobsMode : std::uint8_t {
+        //! In forked worker processes, a crash fails only one test case
+        Processes,
+        //! In worker threads of the test process
+        Threads
+    };
+
     struct ConfigData {
 
         bool listTests = false;
@@ -63,13 +72,33 @@ namespace Catch {
 
         unsigned int shardCount = 1;
         unsigned int shardIndex = 0;
+        ShardStrategy shardStrategy = ShardStrategy::Contiguous;
+        unsigned int jobs = 1;
+        unsigned int testTimeout = 0;
+        JobsMode jobsMode = JobsMode::Processes;
 
         bool skipBenchmarks = false;
         bool benchmarkNoAnalysis = false;
         unsigned int benchmarkSamples = 100;
+        unsigned int benchmarkMinSamples = 10;
+        double benchmarkTargetPrecision = 0;
         double benchmarkConfidenceInterval = 0.95;
         unsigned int benchmarkResamples = 100'000;
+        unsigned int benchmarkAnalysisThreads = 0;
         std::chrono::milliseconds::rep benchmarkWarmupTime = 100;
+        std::vector<std::string> benchmarkCounters;
+        std::string benchmarkSaveBaseline;
+        std::string benchmarkCompareBaseline;
+        double benchmarkRegressionThreshold = -1;
+        bool benchmarkColdCache = false;
+        std::string benchmarkCalibrationCache;
+        bool benchmarkRecalibrate = false;
+        int benchmarkCpu = -1;
+        BenchmarkClock benchmarkClock = BenchmarkClock::Steady;
+        std::vector<double> benchmarkPercentiles;
+        bool benchmarkHistogram = false;
+        bool benchmarkPerIteration = false;
+        std::uint64_t benchmarkBatchMemory = 64 * 1024 * 1024;
 
         Verbosity verbosity = Verbosity::Normal;
         WarnAbout::What warnings = WarnAbout::Nothing;
@@ -88,6 +117,11 @@ namespace Catch {
         std::vector<std::string> sectionsToRun;
 
         std::string prematureExitGuardFilePath;
+        std::string testTimingsFile;
+        std::string testTimingsOutputFile;
+        std::string resultCacheFile;
+        std::string runHistoryFile;
+        std::string cacheKey;
     };
 
 
@@ -117,6 +151,16 @@ namespace Catch {
 
         std::string const& getExitGuardFilePath() const;
 
+        //! Number of workers to run the tests in
+        unsigned int jobs() const;
+        JobsMode jobsMode() const;
+
+        //! Path to the result cache, empty if caching is disabled
+        std::string const& resultCacheFile() const;
+        //! User-provided fingerprint of the build, see `--cache-key`
+        std::string const& cacheKey() const;
+        std::string const& processName() const;
+
         // IConfig interface
         bool allowThrows() const override;
         StringRef name() const override;
@@ -127,9 +171,14 @@ namespace Catch {
         ShowDurations showDurations() const override;
         double minDuration() const override;
         TestRunOrder runOrder() const override;
+        std::string const& runHistoryFile() const override;
         uint32_t rngSeed() const override;
         unsigned int shardCount() const override;
         unsigned int shardIndex() const override;
+        ShardStrategy shardStrategy() const override;
+        std::string const& testTimingsFile() const override;
+        std::string const& testTimingsOutputFile() const override;
+        unsigned int testTimeout() const override;
         ColourMode defaultColourMode() const override;
         bool shouldDebugBreak() const override;
         int abortAfter() const override;
@@ -138,9 +187,25 @@ namespace Catch {
         bool skipBenchmarks() const override;
         bool benchmarkNoAnalysis() const override;
         unsigned int benchmarkSamples() const override;
+        unsigned int benchmarkMinSamples() const override;
+        double benchmarkTargetPrecision() const override;
         double benchmarkConfidenceInterval() const override;
         unsigned int benchmarkResamples() const override;
+        unsigned int benchmarkAnalysisThreads() const override;
         std::chrono::milliseconds benchmarkWarmupTime() const override;
+        std::vector<std::string> const& benchmarkCounters() const override;
+        std::string const& benchmarkSaveBaseline() const override;
+        std::string const& benchmarkCompareBaseline() const override;
+        double benchmarkRegressionThreshold() const override;
+        bool benchmarkColdCache() const override;
+        std::string const& benchmarkCalibrationCache() const override;
+        bool benchmarkRecalibrate() const override;
+        int benchmarkCpu() const override;
+        BenchmarkClock benchmarkClock() const override;
+        std::vector<double> const& benchmarkPercentiles() const override;
+        bool benchmarkHistogram() const override;
+        bool benchmarkPerIteration() const override;
+        std::uint64_t benchmarkBatchMemory() const override;
 
     private:
         // Reads Bazel env vars and applies them to the config
@@ -349,6 +414,13 @@ namespace Catch {
 
     std::string const& Config::getExitGuardFilePath() const { return m_data.prematureExitGuardFilePath; }
 
+    unsigned int Config::jobs() const { return m_data.jobs; }
+    JobsMode Config::jobsMode() const { return m_data.jobsMode; }
+
+    std::string const& Config::resultCacheFile() const { return m_data.resultCacheFile; }
+    std::string const& Config::cacheKey() const { return m_data.cacheKey; }
+    std::string const& Config::processName() const { return m_data.processName; }
+
     // IConfig interface
     bool Config::allowThrows() const                   { return !m_data.noThrow; }
     StringRef Config::name() const { return m_data.name.empty() ? m_data.processName : m_data.name; }
@@ -363,9 +435,14 @@ namespace Catch {
     ShowDurations Config::showDurations() const        { return m_data.showDurations; }
     double Config::minDuration() const                 { return m_data.minDuration; }
     TestRunOrder Config::runOrder() const              { return m_data.runOrder; }
+    std::string const& Config::runHistoryFile() const  { return m_data.runHistoryFile; }
     uint32_t Config::rngSeed() const                   { return m_data.rngSeed; }
     unsigned int Config::shardCount() const            { return m_data.shardCount; }
     unsigned int Config::shardIndex() const            { return m_data.shardIndex; }
+    ShardStrategy Config::shardStrategy() const        { return m_data.shardStrategy; }
+    std::string const& Config::testTimingsFile() const { return m_data.testTimingsFile; }
+    std::string const& Config::testTimingsOutputFile() const { return m_data.testTimingsOutputFile; }
+    unsigned int Config::testTimeout() const           { return m_data.testTimeout; }
     ColourMode Config::defaultColourMode() const       { return m_data.defaultColourMode; }
     bool Config::shouldDebugBreak() const              { return m_data.shouldDebugBreak; }
     int Config::abortAfter() const                     { return m_data.abortAfter; }
@@ -375,9 +452,25 @@ namespace Catch {
     bool Config::skipBenchmarks() const                           { return m_data.skipBenchmarks; }
     bool Config::benchmarkNoAnalysis() const                      { return m_data.benchmarkNoAnalysis; }
     unsigned int Config::benchmarkSamples() const                 { return m_data.benchmarkSamples; }
+    unsigned int Config::benchmarkMinSamples() const              { return m_data.benchmarkMinSamples; }
+    double Config::benchmarkTargetPrecision() const               { return m_data.benchmarkTargetPrecision; }
     double Config::benchmarkConfidenceInterval() const            { return m_data.benchmarkConfidenceInterval; }
     unsigned int Config::benchmarkResamples() const               { return m_data.benchmarkResamples; }
+    unsigned int Config::benchmarkAnalysisThreads() const         { return m_data.benchmarkAnalysisThreads; }
     std::chrono::milliseconds Config::benchmarkWarmupTime() const { return std::chrono::milliseconds(m_data.benchmarkWarmupTime); }
+    std::vector<std::string> const& Config::benchmarkCounters() const { return m_data.benchmarkCounters; }
+    std::string const& Config::benchmarkSaveBaseline() const      { return m_data.benchmarkSaveBaseline; }
+    std::string const& Config::benchmarkCompareBaseline() const   { return m_data.benchmarkCompareBaseline; }
+    double Config::benchmarkRegressionThreshold() const           { return m_data.benchmarkRegressionThreshold; }
+    bool Config::benchmarkColdCache() const                       { return m_data.benchmarkColdCache; }
+    std::string const& Config::benchmarkCalibrationCache() const  { return m_data.benchmarkCalibrationCache; }
+    bool Config::benchmarkRecalibrate() const                     { return m_data.benchmarkRecalibrate; }
+    int Config::benchmarkCpu() const                              { return m_data.benchmarkCpu; }
+    BenchmarkClock Config::benchmarkClock() const                 { return m_data.benchmarkClock; }
+    std::vector<double> const& Config::benchmarkPercentiles() const { return m_data.benchmarkPercentiles; }
+    bool Config::benchmarkHistogram() const                       { return m_data.benchmarkHistogram; }
+    bool Config::benchmarkPerIteration() const                    { return m_data.benchmarkPerIteration; }
+    std::uint64_t Config::benchmarkBatchMemory() const            { return m_data.benchmarkBatchMemory; }
 
     void Config::readBazelEnvVars() {
         // Register a JUnit reporter for Bazel. Bazel sets an environment
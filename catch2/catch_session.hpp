@@ -90,6 +90,11 @@ namespace Catch {
 #include "catch_version.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_startup_exception_registry.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_sharding.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+#include "benchmark/detail/catch_benchmark_baseline.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_run_history.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_test_result_cache.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_test_timings.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_test_case_registry_impl.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_textflow.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_windows_h_proxy.hpp"  // Adjust to relative path (@wolfram77)
@@ -98,12 +103,16 @@ namespace Catch {
 #include "interfaces/catch_interfaces_reporter_factory.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_string_manip.hpp"  // Adjust to relative path (@wolfram77)
 #include "internal/catch_istream.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_worker_processes.hpp"  // Adjust to relative path (@wolfram77)
+#include "internal/catch_worker_threads.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
 #include <exception>
+#include <fstream>
 #include <iomanip>
 #include <set>
 
@@ -117,8 +126,12 @@ namespace Catch {
             return reporter;
         }
 
-        IEventListenerPtr prepareReporters(Config const* config) {
+        IEventListenerPtr prepareReporters(Config const* config, TestResultCache* resultCache) {
             if (Catch::getRegistryHub().getReporterRegistry().getListeners().empty()
+                    && testTimingsOutputPath( *config ).empty()
+                    && config->runHistoryFile().empty()
+                    && config->benchmarkSaveBaseline().empty()
+                    && !resultCache
                     && config->getProcessedReporterSpecs().size() == 1) {
                 auto const& spec = config->getProcessedReporterSpecs()[0];
                 return createReporter(
@@ -135,6 +148,22 @@ namespace Catch {
             for (auto const& listener : listeners) {
                 multi->addListener(listener->create(config));
             }
+            if ( !testTimingsOutputPath( *config ).empty() ) {
+                multi->addListener(
+                    Detail::make_unique<TestTimingsRecorder>( config ) );
+            }
+            if ( !config->runHistoryFile().empty() ) {
+                multi->addListener(
+                    Detail::make_unique<RunHistoryRecorder>( config ) );
+            }
+            if ( !config->benchmarkSaveBaseline().empty() ) {
+                multi->addListener(
+                    Detail::make_unique<BenchmarkBaselineRecorder>( config ) );
+            }
+            if ( resultCache ) {
+                multi->addListener( Detail::make_unique<TestResultCacheRecorder>(
+                    config, *resultCache ) );
+            }
 
             for ( auto const& reporterSpec : config->getProcessedReporterSpecs() ) {
                 multi->addReporter( createReporter(
@@ -150,9 +179,15 @@ namespace Catch {
 
         class TestGroup {
         public:
-            explicit TestGroup(IEventListenerPtr&& reporter, Config const* config):
+            explicit TestGroup(IEventListenerPtr&& reporter, Config const* config, TestResultCache const* resultCache):
                 m_reporter(reporter.get()),
                 m_config{config},
+#if defined( CATCH_CONFIG_FORK )
+                m_workerProcesses{config, *m_reporter},
+#endif
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+                m_workerThreads{config, *m_reporter},
+#endif
                 m_context{config, CATCH_MOVE(reporter)} {
 
                 assert( m_config->testSpec().getInvalidSpecs().empty() &&
@@ -175,11 +210,56 @@ namespace Catch {
                     }
                 }
 
-                m_tests = createShard(m_tests, m_config->shardCount(), m_config->shardIndex());
+                if ( m_config->shardStrategy() == ShardStrategy::Balanced ) {
+                    TestTimings const timings( m_config->testTimingsFile() );
+                    m_tests = createBalancedShard(
+                        m_tests,
+                        m_config->shardCount(),
+                        m_config->shardIndex(),
+                        [&]( TestCaseHandle const* test ) {
+                            return timings.estimate( test->getTestCaseInfo() );
+                        } );
+                } else {
+                    m_tests = createShard(m_tests, m_config->shardCount(), m_config->shardIndex());
+                }
+
+                // Cached tests are removed only after sharding, so that the
+                // shards do not change as tests start and stop passing.
+                if ( resultCache ) {
+                    for ( auto it = m_tests.begin(); it != m_tests.end(); ) {
+                        if ( resultCache->hasPassed( ( *it )->getTestCaseInfo() ) ) {
+                            m_cachedTests.push_back( *it );
+                            it = m_tests.erase( it );
+                        } else {
+                            ++it;
+                        }
+                    }
+                }
             }
 
             Totals execute() {
+                for ( auto const* testCase : m_cachedTests ) {
+                    m_reporter->testCaseCached( testCase->getTestCaseInfo() );
+                }
+
                 Totals totals;
+                if ( m_config->jobs() > 1 ) {
+                    std::vector<TestCaseHandle const*> tests( m_tests.begin(), m_tests.end() );
+#if defined( CATCH_CONFIG_FORK )
+                    if ( m_config->jobsMode() == JobsMode::Processes ) {
+                        totals = m_workerProcesses.runTests( tests, m_config->jobs() );
+                    }
+#endif
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+                    if ( m_config->jobsMode() == JobsMode::Threads ) {
+                        warnAboutIgnoredTimeouts( tests );
+                        totals = m_workerThreads.runTests( tests, m_config->jobs() );
+                    }
+#endif
+                    m_context.addExternalTotals( totals );
+                    reportUnmatchedTestSpecs();
+                    return totals;
+                }
                 for (auto const& testCase : m_tests) {
                     if (!m_context.aborting())
                         totals += m_context.runTest(*testCase);
@@ -187,12 +267,7 @@ namespace Catch {
                         m_reporter->skipTest(testCase->getTestCaseInfo());
                 }
 
-                for (auto const& match : m_matches) {
-                    if (match.tests.empty()) {
-                        m_unmatchedTestSpecs = true;
-                        m_reporter->noMatchingTestCases( match.name );
-                    }
-                }
+                reportUnmatchedTestSpecs();
 
                 return totals;
             }
@@ -201,12 +276,49 @@ namespace Catch {
                 return m_unmatchedTestSpecs;
             }
 
+            bool hadCachedTests() const {
+                return !m_cachedTests.empty();
+            }
+
 
         private:
+            void warnAboutIgnoredTimeouts( std::vector<TestCaseHandle const*> const& tests ) const {
+                std::size_t timedTests = 0;
+                for ( auto const* test : tests ) {
+                    if ( Detail::testTimeoutFor( *m_config, test->getTestCaseInfo() ) > 0 ) {
+                        ++timedTests;
+                    }
+                }
+                if ( timedTests > 0 ) {
+                    Catch::cerr() << "Warning: " << pluralise( timedTests, "test case"_sr )
+                                  << " with a [timeout:N] tag will run without the timeout, "
+                                     "timeouts are not supported with --jobs-mode thread\n"
+                                  << std::flush;
+                }
+            }
+
+            void reportUnmatchedTestSpecs() {
+                for (auto const& match : m_matches) {
+                    if (match.tests.empty()) {
+                        m_unmatchedTestSpecs = true;
+                        m_reporter->noMatchingTestCases( match.name );
+                    }
+                }
+            }
+
             IEventListener* m_reporter;
             Config const* m_config;
+            // Worker pools have to outlive m_context, because they own
+            // strings referenced by the events they reported.
+#if defined( CATCH_CONFIG_FORK )
+            WorkerProcessPool m_workerProcesses;
+#endif
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+            WorkerThreadPool m_workerThreads;
+#endif
             RunContext m_context;
             std::set<TestCaseHandle const*> m_tests;
+            std::vector<TestCaseHandle const*> m_cachedTests;
             TestSpec::Matches m_matches;
             bool m_unmatchedTestSpecs = false;
         };
@@ -417,6 +529,54 @@ namespace Catch {
             return UnspecifiedErrorExitCode;
         }
 
+        if ( m_configData.jobs > 1 ) {
+#if !defined( CATCH_CONFIG_FORK )
+            if ( m_configData.jobsMode == JobsMode::Processes ) {
+                Catch::cerr() << "Running tests in multiple processes is not supported on this platform\n"
+                              << std::flush;
+                return UnspecifiedErrorExitCode;
+            }
+#endif
+#if !defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+            if ( m_configData.jobsMode == JobsMode::Threads ) {
+                Catch::cerr() << "Running tests in multiple threads requires CATCH_CONFIG_THREAD_SAFE_ASSERTIONS\n"
+                              << std::flush;
+                return UnspecifiedErrorExitCode;
+            }
+#endif
+            // A hung test cannot be stopped without ending the process,
+            // which would take down the tests of the other threads
+            if ( m_configData.jobsMode == JobsMode::Threads &&
+                 m_configData.testTimeout > 0 ) {
+                Catch::cerr() << "Test timeouts (--test-timeout) are not supported with --jobs-mode thread\n"
+                              << std::flush;
+                return UnspecifiedErrorExitCode;
+            }
+        }
+
+        if ( m_configData.benchmarkRegressionThreshold >= 0 &&
+             m_configData.benchmarkCompareBaseline.empty() ) {
+            Catch::cerr() << "--benchmark-fail-on-regression requires a baseline to compare against (--benchmark-compare)\n"
+                          << std::flush;
+            return UnspecifiedErrorExitCode;
+        }
+
+#if !defined( CATCH_PLATFORM_LINUX )
+        if ( m_configData.benchmarkCpu >= 0 ) {
+            Catch::cerr() << "Pinning benchmarks to a CPU (--benchmark-cpu) is only supported on Linux\n"
+                          << std::flush;
+            return UnspecifiedErrorExitCode;
+        }
+#endif
+
+#if !defined( CATCH_CONFIG_USE_ASYNC )
+        if ( m_configData.testTimeout > 0 ) {
+            Catch::cerr() << "Test timeouts require threads (CATCH_CONFIG_USE_ASYNC)\n"
+                          << std::flush;
+            return UnspecifiedErrorExitCode;
+        }
+#endif
+
         CATCH_TRY {
             config(); // Force config to be constructed
 
@@ -433,8 +593,39 @@ namespace Catch {
             // Set up global config instance before we start calling into other functions
             getCurrentMutableContext().setConfig(m_config.get());
 
+            // The cache has to outlive the reporter, which records into it
+            Detail::unique_ptr<TestResultCache> resultCache;
+            if ( !m_config->resultCacheFile().empty() ) {
+                const auto fingerprint = computeBuildFingerprint(
+                    m_config->cacheKey(), m_config->processName() );
+                if ( fingerprint != 0 ) {
+                    resultCache = Detail::make_unique<TestResultCache>(
+                        m_config->resultCacheFile(), fingerprint );
+                } else {
+                    Catch::cerr()
+                        << "Warning: could not fingerprint the executable, "
+                           "result cache is disabled. Use --cache-key.\n";
+                }
+            }
+
+            if ( !m_config->testTimingsFile().empty() &&
+                 testTimingsOutputPath( *m_config ).empty() ) {
+                Catch::cerr() << "Warning: balanced shards do not record test timings into the timings file "
+                                 "they split the tests by, use --test-timings-output\n";
+            }
+
+            if ( !m_config->benchmarkCompareBaseline().empty() ) {
+                const auto baselinePath = BenchmarkBaseline::pathFor(
+                    m_config->benchmarkCompareBaseline() );
+                if ( !std::ifstream( baselinePath ) ) {
+                    Catch::cerr() << "Warning: benchmark baseline '"
+                                  << baselinePath
+                                  << "' does not exist, benchmarks will not be compared\n";
+                }
+            }
+
             // Create reporter(s) so we can route listings through them
-            auto reporter = prepareReporters(m_config.get());
+            auto reporter = prepareReporters(m_config.get(), resultCache.get());
 
             auto const& invalidSpecs = m_config->testSpec().getInvalidSpecs();
             if ( !invalidSpecs.empty() ) {
@@ -450,7 +641,7 @@ namespace Catch {
                 return 0;
             }
 
-            TestGroup tests { CATCH_MOVE(reporter), m_config.get() };
+            TestGroup tests { CATCH_MOVE(reporter), m_config.get(), resultCache.get() };
             auto const totals = tests.execute();
 
             // If we got here, running the tests finished normally-enough.
@@ -463,6 +654,7 @@ namespace Catch {
             }
 
             if ( totals.testCases.total() == 0
+                && !tests.hadCachedTests()
                 && !m_config->zeroTestsCountAsSuccess() ) {
                 return NoTestsRunExitCode;
             }
@@ -123,6 +123,15 @@
 #    error Cannot force POSIX_SIGNALS to both ON and OFF
 #endif
 
+#ifndef CATCH_CONFIG_NO_FORK
+// #define CATCH_CONFIG_FORK
+#endif
+
+#if defined( CATCH_CONFIG_FORK ) && \
+    defined( CATCH_CONFIG_NO_FORK )
+#    error Cannot force FORK to both ON and OFF
+#endif
+
 #ifndef CATCH_CONFIG_NO_GETENV
 // #define CATCH_CONFIG_GETENV
 #endif
@@ -203,6 +212,7 @@
 
 
 //#define CATCH_CONFIG_BAZEL_SUPPORT
+//#define CATCH_CONFIG_BENCHMARK_TRACK_ALLOCATIONS
 //#define CATCH_CONFIG_DISABLE_EXCEPTIONS
 //#define CATCH_CONFIG_DISABLE_EXCEPTIONS_CUSTOM_HANDLER
 //#define CATCH_CONFIG_DISABLE
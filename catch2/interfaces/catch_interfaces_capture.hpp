@@ -136,6 +136,15 @@ namespace Catch {
 namespace Catch {
     namespace Detail {
         void missingCaptureInstance() {
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+            // Test cases running in threads leave no global capture for
+            // the threads they start to fall back to
+            if ( getCurrentContext().getConfig() ) {
+                CATCH_ERROR( "No result capture for the calling thread. With "
+                             "--jobs-mode thread, threads started by a test case "
+                             "need a Catch::ThreadResultCaptureScope to assert" );
+            }
+#endif
             CATCH_INTERNAL_ERROR( "No result capture instance" );
         }
     } // namespace Detail
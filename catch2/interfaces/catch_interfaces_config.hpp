@@ -11,6 +11,7 @@
 #include "../internal/catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -38,7 +39,21 @@ namespace Catch {
     enum class TestRunOrder {
         Declared,
         LexicographicallySorted,
-        Randomized
+        Randomized,
+        //! Recently failing tests first, then tests from recently changed files
+        FailedFirst
+    };
+    enum class ShardStrategy {
+        //! Shards are contiguous slices with the same number of tests
+        Contiguous,
+        //! Shards have roughly the same total duration of tests
+        Balanced
+    };
+    enum class BenchmarkClock {
+        //! `std::chrono::steady_clock`
+        Steady,
+        //! Time stamp counter of x86 CPUs, steady clock elsewhere
+        Tsc
     };
     enum class ColourMode : std::uint8_t {
         //! Let Catch2 pick implementation based on platform detection
@@ -79,9 +94,18 @@ namespace Catch {
         virtual bool hasTestFilters() const = 0;
         virtual std::vector<std::string> const& getTestsOrTags() const = 0;
         virtual TestRunOrder runOrder() const = 0;
+        //! Path to the file with results of the previous runs
+        virtual std::string const& runHistoryFile() const = 0;
         virtual uint32_t rngSeed() const = 0;
         virtual unsigned int shardCount() const = 0;
         virtual unsigned int shardIndex() const = 0;
+        //! Default timeout of a test case in seconds, 0 if there is none
+        virtual unsigned int testTimeout() const = 0;
+        virtual ShardStrategy shardStrategy() const = 0;
+        //! Path to the file with recorded durations of test cases
+        virtual std::string const& testTimingsFile() const = 0;
+        //! Path to record durations of test cases to, if not `testTimingsFile`
+        virtual std::string const& testTimingsOutputFile() const = 0;
         virtual ColourMode defaultColourMode() const = 0;
         virtual std::vector<std::string> const& getSectionsToRun() const = 0;
         virtual Verbosity verbosity() const = 0;
@@ -89,9 +113,45 @@ namespace Catch {
         virtual bool skipBenchmarks() const = 0;
         virtual bool benchmarkNoAnalysis() const = 0;
         virtual unsigned int benchmarkSamples() const = 0;
+        //! Samples taken before sampling can stop at the target precision
+        virtual unsigned int benchmarkMinSamples() const = 0;
+        //! Half-width of the confidence interval of the mean in percent of
+        //! the mean, at which sampling stops early. 0 if it never does, and
+        //! `benchmarkSamples` are always taken.
+        virtual double benchmarkTargetPrecision() const = 0;
         virtual double benchmarkConfidenceInterval() const = 0;
         virtual unsigned int benchmarkResamples() const = 0;
+        //! Number of threads for benchmark analysis, 0 for one per core
+        virtual unsigned int benchmarkAnalysisThreads() const = 0;
         virtual std::chrono::milliseconds benchmarkWarmupTime() const = 0;
+        //! Names of hardware counters to measure alongside benchmarks
+        virtual std::vector<std::string> const& benchmarkCounters() const = 0;
+        //! Name of the baseline to save benchmark samples to, if any
+        virtual std::string const& benchmarkSaveBaseline() const = 0;
+        //! Name of the baseline to compare benchmarks against, if any
+        virtual std::string const& benchmarkCompareBaseline() const = 0;
+        //! Slowdown in percent that fails the benchmark, negative if none does
+        virtual double benchmarkRegressionThreshold() const = 0;
+        //! Should all benchmarks run with data caches evicted before
+        //! every iteration?
+        virtual bool benchmarkColdCache() const = 0;
+        //! Path to the file with clock calibrations of previous runs
+        virtual std::string const& benchmarkCalibrationCache() const = 0;
+        //! Should the clock be calibrated even if the cache has it?
+        virtual bool benchmarkRecalibrate() const = 0;
+        //! CPU to pin the benchmarking thread to, negative if none.
+        //! Threads started by benchmarks inherit the pinning.
+        virtual int benchmarkCpu() const = 0;
+        virtual BenchmarkClock benchmarkClock() const = 0;
+        //! Percentiles of the samples to estimate, e.g. 99.9 for p99.9
+        virtual std::vector<double> const& benchmarkPercentiles() const = 0;
+        //! Should the latency histogram of the samples be reported?
+        virtual bool benchmarkHistogram() const = 0;
+        //! Should every iteration be timed on its own, for its tail
+        //! latency? Ignored when iterations are too short for that.
+        virtual bool benchmarkPerIteration() const = 0;
+        //! Bytes the inputs of a batched benchmark may take at once
+        virtual std::uint64_t benchmarkBatchMemory() const = 0;
     };
 }
 
@@ -207,6 +207,15 @@ namespace Catch {
          */
         virtual void skipTest( TestCaseInfo const& testInfo ) = 0;
 
+        /**
+         * Called instead of running a test case, when the result cache
+         * says that it already passed with the same build
+         *
+         * Cached test cases are not included in the run's totals.
+         * Does nothing by default.
+         */
+        virtual void testCaseCached( TestCaseInfo const& testInfo );
+
         //! Called if a fatal error (signal/structured exception) occurred
         virtual void fatalErrorEncountered( StringRef error ) = 0;
 
@@ -322,6 +331,8 @@ namespace Catch {
 
     IEventListener::~IEventListener() = default;
 
+    void IEventListener::testCaseCached( TestCaseInfo const& ) {}
+
 } // end namespace Catch
 #endif // CATCH2_IMPLEMENTATION
 #endif // CATCH_INTERFACES_REPORTER_CPP_INCLUDED
@@ -41,6 +41,8 @@ namespace Catch {
 #include "catch_console_colour.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_parse_numbers.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_reporter_spec_parser.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_perf_counters.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <fstream>
 #include <string>
@@ -91,6 +93,8 @@ namespace Catch {
                     config.runOrder = TestRunOrder::LexicographicallySorted;
                 else if( startsWith( "random", order ) )
                     config.runOrder = TestRunOrder::Randomized;
+                else if( startsWith( "failed-first", order ) )
+                    config.runOrder = TestRunOrder::FailedFirst;
                 else
                     return ParserResult::runtimeError( "Unrecognised ordering: '" + order + '\'' );
                 return ParserResult::ok( ParseResultType::Matched );
@@ -229,6 +233,33 @@ namespace Catch {
         return ParserResult::ok( ParseResultType::Matched );
     };
 
+        auto const setJobs = [&]( std::string const& jobs ) {
+            auto parsedJobs = parseUInt( jobs );
+            if ( !parsedJobs ) {
+                return ParserResult::runtimeError(
+                    "Could not parse '" + jobs + "' as number of jobs" );
+            }
+            if ( *parsedJobs == 0 ) {
+                return ParserResult::runtimeError(
+                    "Number of jobs must be positive" );
+            }
+            config.jobs = *parsedJobs;
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setJobsMode = [&]( std::string const& jobsMode ) {
+            const auto mode = toLower( jobsMode );
+            if ( mode == "process" ) {
+                config.jobsMode = JobsMode::Processes;
+            } else if ( mode == "thread" ) {
+                config.jobsMode = JobsMode::Threads;
+            } else {
+                return ParserResult::runtimeError(
+                    "Unrecognised jobs mode: '" + jobsMode + '\'' );
+            }
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
         auto const setShardIndex = [&](std::string const& shardIndex) {
             auto parsedIndex = parseUInt( shardIndex );
             if ( !parsedIndex ) {
@@ -239,6 +270,111 @@ namespace Catch {
             return ParserResult::ok( ParseResultType::Matched );
         };
 
+        auto const setTestTimeout = [&]( std::string const& timeout ) {
+            auto parsedTimeout = parseUInt( timeout );
+            if ( !parsedTimeout ) {
+                return ParserResult::runtimeError(
+                    "Could not parse '" + timeout + "' as test timeout" );
+            }
+            config.testTimeout = *parsedTimeout;
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setShardStrategy = [&]( std::string const& strategy ) {
+            const auto lcStrategy = toLower( strategy );
+            if ( lcStrategy == "contiguous" ) {
+                config.shardStrategy = ShardStrategy::Contiguous;
+            } else if ( lcStrategy == "balanced" ) {
+                config.shardStrategy = ShardStrategy::Balanced;
+            } else {
+                return ParserResult::runtimeError(
+                    "Unrecognised shard strategy: '" + strategy + '\'' );
+            }
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setBenchmarkClock = [&]( std::string const& clock ) {
+            const auto lcClock = toLower( clock );
+            if ( lcClock == "steady" ) {
+                config.benchmarkClock = BenchmarkClock::Steady;
+            } else if ( lcClock == "tsc" ) {
+                config.benchmarkClock = BenchmarkClock::Tsc;
+            } else {
+                return ParserResult::runtimeError(
+                    "Unrecognised benchmark clock: '" + clock + '\'' );
+            }
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setBenchmarkCounters = [&]( std::string const& counters ) {
+            config.benchmarkCounters.clear();
+            for ( auto counter : splitStringRef( counters, ',' ) ) {
+                counter = trim( counter );
+                if ( !Benchmark::Detail::isKnownPerfCounter( counter ) ) {
+                    return ParserResult::runtimeError(
+                        "Unrecognised benchmark counter: '" +
+                        static_cast<std::string>( counter ) +
+                        "', known counters are: " +
+                        static_cast<std::string>(
+                            Benchmark::Detail::knownPerfCounterNames() ) );
+                }
+                config.benchmarkCounters.emplace_back( counter );
+            }
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setBenchmarkPercentiles = [&]( std::string const& percentiles ) {
+            config.benchmarkPercentiles.clear();
+            for ( auto percentile : splitStringRef( percentiles, ',' ) ) {
+                const auto text = static_cast<std::string>( trim( percentile ) );
+                bool parsed = false;
+                CATCH_TRY {
+                    std::size_t parsedTo = 0;
+                    const double value = std::stod( text, &parsedTo );
+                    if ( parsedTo == text.size() && value >= 0 && value <= 100 ) {
+                        config.benchmarkPercentiles.push_back( value );
+                        parsed = true;
+                    }
+                } CATCH_CATCH_ANON( std::exception const& ) {}
+                if ( !parsed ) {
+                    return ParserResult::runtimeError(
+                        "Could not parse '" + text + "' as percentile between 0 and 100" );
+                }
+            }
+            return ParserResult::ok( ParseResultType::Matched );
+        };
+
+        auto const setRegressionThreshold = [&]( std::string const& threshold ) {
+            CATCH_TRY {
+                std::size_t parsedTo = 0;
+                const double percent = std::stod( threshold, &parsedTo );
+                if ( parsedTo == threshold.size() && percent >= 0 ) {
+                    config.benchmarkRegressionThreshold = percent;
+                    return ParserResult::ok( ParseResultType::Matched );
+                }
+            } CATCH_CATCH_ANON( std::exception const& ) {}
+            return ParserResult::runtimeError(
+                "Could not parse '" + threshold + "' as regression threshold" );
+        };
+
+        auto const setTargetPrecision = [&]( std::string const& precision ) {
+            // Both "1" and "1%" mean one percent
+            std::string number = precision;
+            if ( !number.empty() && number.back() == '%' ) {
+                number.pop_back();
+            }
+            CATCH_TRY {
+                std::size_t parsedTo = 0;
+                const double percent = std::stod( number, &parsedTo );
+                if ( parsedTo == number.size() && percent > 0 ) {
+                    config.benchmarkTargetPrecision = percent;
+                    return ParserResult::ok( ParseResultType::Matched );
+                }
+            } CATCH_CATCH_ANON( std::exception const& ) {}
+            return ParserResult::runtimeError(
+                "Could not parse '" + precision + "' as target precision" );
+        };
+
         auto cli
             = ExeName( config.processName )
             | Help( config.showHelp )
@@ -302,9 +438,12 @@ namespace Catch {
             | Opt( config.listListeners )
                 ["--list-listeners"]
                 ( "list all listeners" )
-            | Opt( setTestOrder, "decl|lex|rand" )
+            | Opt( setTestOrder, "decl|lex|rand|failed-first" )
                 ["--order"]
                 ( "test case order (defaults to rand)" )
+            | Opt( config.runHistoryFile, "path" )
+                ["--run-history"]
+                ( "file to read and record test results for --order failed-first" )
             | Opt( setRngSeed, "'time'|'random-device'|number" )
                 ["--rng-seed"]
                 ( "set a specific seed for random numbers" )
@@ -322,10 +461,19 @@ namespace Catch {
                 ( "disable running benchmarks")
             | Opt( setBenchmarkSamples, "samples"  )
                 ["--benchmark-samples"]
-                ( "number of samples to collect (default: 100)" )
+                ( "number of samples to collect, at most with a target precision (default: 100)" )
+            | Opt( setTargetPrecision, "percent" )
+                ["--benchmark-target-precision"]
+                ( "stop sampling once the confidence interval of the mean is within <percent> of it" )
+            | Opt( config.benchmarkMinSamples, "samples" )
+                ["--benchmark-min-samples"]
+                ( "samples to collect before stopping at the target precision (default: 10)" )
             | Opt( config.benchmarkResamples, "resamples" )
                 ["--benchmark-resamples"]
                 ( "number of resamples for the bootstrap (default: 100000)" )
+            | Opt( config.benchmarkAnalysisThreads, "threads" )
+                ["--benchmark-analysis-threads"]
+                ( "number of threads for the bootstrap (default: one per core)" )
             | Opt( config.benchmarkConfidenceInterval, "confidence interval" )
                 ["--benchmark-confidence-interval"]
                 ( "confidence interval for the bootstrap (between 0 and 1, default: 0.95)" )
@@ -335,12 +483,75 @@ namespace Catch {
             | Opt( config.benchmarkWarmupTime, "benchmarkWarmupTime" )
                 ["--benchmark-warmup-time"]
                 ( "amount of time in milliseconds spent on warming up each test (default: 100)" )
+            | Opt( setBenchmarkCounters, "counter,..." )
+                ["--benchmark-counters"]
+                ( "hardware counters to measure alongside benchmarks (e.g. cycles,instructions)" )
+            | Opt( config.benchmarkSaveBaseline, "name" )
+                ["--benchmark-save-baseline"]
+                ( "save benchmark samples as baseline <name> (into <name>.baseline)" )
+            | Opt( config.benchmarkCompareBaseline, "name" )
+                ["--benchmark-compare"]
+                ( "compare benchmarks against baseline <name>" )
+            | Opt( setRegressionThreshold, "percent" )
+                ["--benchmark-fail-on-regression"]
+                ( "fail benchmarks significantly slower than the compared baseline by more than <percent>" )
+            | Opt( config.benchmarkColdCache )
+                ["--benchmark-cold-cache"]
+                ( "evict data caches before every benchmark iteration, and time iterations one by one" )
+            | Opt( config.benchmarkCalibrationCache, "path" )
+                ["--benchmark-calibration-cache"]
+                ( "file to reuse clock calibration from, shared by benchmark binaries" )
+            | Opt( config.benchmarkRecalibrate )
+                ["--benchmark-recalibrate"]
+                ( "calibrate the clock even if the calibration cache has a fresh entry" )
+            | Opt( config.benchmarkCpu, "id" )
+                ["--benchmark-cpu"]
+                ( "pin the thread running benchmarks to CPU <id> (Linux only)" )
+            | Opt( setBenchmarkClock, "steady|tsc" )
+                ["--benchmark-clock"]
+                ( "clock to time benchmarks with, tsc needs an invariant x86 TSC (default: steady)" )
+            | Opt( setBenchmarkPercentiles, "percentile,..." )
+                ["--benchmark-percentiles"]
+                ( "percentiles of the samples to estimate with confidence intervals (e.g. 50,99,99.9)" )
+            | Opt( config.benchmarkHistogram )
+                ["--benchmark-histogram"]
+                ( "report a histogram of the samples with logarithmic buckets" )
+            | Opt( config.benchmarkPerIteration )
+                ["--benchmark-per-iteration"]
+                ( "time every benchmark iteration on its own, for percentiles, histogram, max and jitter of iterations" )
+            | Opt( config.benchmarkBatchMemory, "bytes" )
+                ["--benchmark-batch-memory"]
+                ( "memory the inputs of batched benchmarks may take at once, larger samples are split (default: 64 MiB)" )
             | Opt( setShardCount, "shard count" )
                 ["--shard-count"]
                 ( "split the tests to execute into this many groups" )
             | Opt( setShardIndex, "shard index" )
                 ["--shard-index"]
                 ( "index of the group of tests to execute (see --shard-count)" )
+            | Opt( setShardStrategy, "contiguous|balanced" )
+                ["--shard-strategy"]
+                ( "split tests into shards of equal count or of equal duration (default: contiguous)" )
+            | Opt( config.testTimingsFile, "path" )
+                ["--test-timings-file"]
+                ( "file to read and record test durations for balanced sharding" )
+            | Opt( config.testTimingsOutputFile, "path" )
+                ["--test-timings-output"]
+                ( "file to record test durations to instead of --test-timings-file, needed by balanced shards to record them" )
+            | Opt( config.resultCacheFile, "path" )
+                ["--result-cache"]
+                ( "do not rerun tests that passed with the same build, remember results in this file" )
+            | Opt( config.cacheKey, "key" )
+                ["--cache-key"]
+                ( "fingerprint of the build for --result-cache (default: hash of the executable)" )
+            | Opt( setJobs, "number of jobs" )
+                ["-j"]["--jobs"]
+                ( "run tests in this many workers (default: 1)" )
+            | Opt( setJobsMode, "process|thread" )
+                ["--jobs-mode"]
+                ( "run the jobs in processes or threads (default: process)" )
+            | Opt( setTestTimeout, "seconds" )
+                ["--test-timeout"]
+                ( "fail and stop the run when a test case runs longer than this (0 for no timeout)" )
             | Opt( config.allowZeroTests )
                 ["--allow-running-no-tests"]
                 ( "Treat 'No tests run' as a success" )
@@ -13,6 +13,7 @@
 //
 // CATCH_CONFIG_WINDOWS_SEH : is Windows SEH supported?
 // CATCH_CONFIG_POSIX_SIGNALS : are POSIX signals supported?
+// CATCH_CONFIG_FORK : can tests be run in forked worker processes?
 // CATCH_CONFIG_DISABLE_EXCEPTIONS : Are exceptions enabled?
 // ****************
 // Note to maintainers: if new toggles are added please document them
@@ -161,6 +162,13 @@
 #    define CATCH_INTERNAL_CONFIG_POSIX_SIGNALS
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// Running tests in worker processes needs fork, pipes and poll, and we only
+// enable it on platforms where we know they behave
+#if defined( CATCH_PLATFORM_LINUX ) || defined( CATCH_PLATFORM_MAC )
+#    define CATCH_INTERNAL_CONFIG_FORK
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Assume that some platforms do not support getenv.
 #if defined( CATCH_PLATFORM_WINDOWS_UWP ) ||                                   \
@@ -326,6 +334,10 @@
 #   define CATCH_CONFIG_POSIX_SIGNALS
 #endif
 
+#if defined(CATCH_INTERNAL_CONFIG_FORK) && !defined(CATCH_CONFIG_NO_FORK) && !defined(CATCH_CONFIG_FORK)
+#   define CATCH_CONFIG_FORK
+#endif
+
 #if defined(CATCH_INTERNAL_CONFIG_GETENV) && !defined(CATCH_INTERNAL_CONFIG_NO_GETENV) && !defined(CATCH_CONFIG_NO_GETENV) && !defined(CATCH_CONFIG_GETENV)
 #   define CATCH_CONFIG_GETENV
 #endif
@@ -23,9 +23,18 @@ namespace Catch {
         friend Context const& getCurrentContext();
 
     public:
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+        //! Returns the calling thread's result capture if it has one,
+        //! and the global one otherwise
+        IResultCapture* getResultCapture() const;
+        //! Sets result capture that is used only by the calling thread,
+        //! so that multiple threads can run tests at the same time
+        static void setThreadResultCapture( IResultCapture* resultCapture );
+#else
         constexpr IResultCapture* getResultCapture() const {
             return m_resultCapture;
         }
+#endif
         constexpr IConfig const* getConfig() const { return m_config; }
         constexpr void setResultCapture( IResultCapture* resultCapture ) {
             m_resultCapture = resultCapture;
@@ -35,6 +44,33 @@ namespace Catch {
 
     Context& getCurrentMutableContext();
 
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+    /**
+     * Makes the calling thread assert into the given result capture,
+     * until the scope ends
+     *
+     * With `--jobs-mode thread`, threads started by a test case cannot
+     * tell which of the concurrently running test cases they belong to,
+     * so they have to be handed its capture:
+     *
+     *     auto* capture = Catch::getCurrentContext().getResultCapture();
+     *     std::thread t( [capture] {
+     *         Catch::ThreadResultCaptureScope scope( capture );
+     *         CHECK( ... );
+     *     } );
+     */
+    class ThreadResultCaptureScope {
+        IResultCapture* m_previous;
+
+    public:
+        explicit ThreadResultCaptureScope( IResultCapture* resultCapture );
+        ~ThreadResultCaptureScope();
+
+        ThreadResultCaptureScope( ThreadResultCaptureScope const& ) = delete;
+        ThreadResultCaptureScope& operator=( ThreadResultCaptureScope const& ) = delete;
+    };
+#endif
+
     inline Context const& getCurrentContext() {
         return Context::currentContext;
     }
@@ -59,17 +95,45 @@ namespace Catch {
 // SPDX-License-Identifier: BSL-1.0
 // #include "catch_context.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
 #include "catch_random_number_generator.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_thread_local.hpp"  // Adjust to relative path (@wolfram77)
 
 namespace Catch {
 
     Context Context::currentContext;
 
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+    namespace {
+        thread_local IResultCapture* g_threadResultCapture = nullptr;
+    }
+
+    IResultCapture* Context::getResultCapture() const {
+        if ( g_threadResultCapture ) {
+            return g_threadResultCapture;
+        }
+        return m_resultCapture;
+    }
+
+    void Context::setThreadResultCapture( IResultCapture* resultCapture ) {
+        g_threadResultCapture = resultCapture;
+    }
+
+    ThreadResultCaptureScope::ThreadResultCaptureScope( IResultCapture* resultCapture ):
+        m_previous( g_threadResultCapture ) {
+        g_threadResultCapture = resultCapture;
+    }
+
+    ThreadResultCaptureScope::~ThreadResultCaptureScope() {
+        g_threadResultCapture = m_previous;
+    }
+#endif
+
     Context& getCurrentMutableContext() {
         return Context::currentContext;
     }
 
     SimplePcg32& sharedRng() {
-        static SimplePcg32 s_rng;
+        // Threads running tests concurrently seed and use their own copy
+        static CATCH_INTERNAL_THREAD_LOCAL SimplePcg32 s_rng;
         return s_rng;
     }
 
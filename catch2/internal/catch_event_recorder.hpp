@@ -0,0 +1,883 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_EVENT_RECORDER_HPP_INCLUDED
+#define CATCH_EVENT_RECORDER_HPP_INCLUDED
+
+#include "../interfaces/catch_interfaces_reporter.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_totals.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <set>
+#include <string>
+
+namespace Catch {
+    namespace Detail {
+
+        /**
+         * Kinds of frames in a stream of recorded events.
+         *
+         * Every frame is stored as its payload size (4 bytes), its kind
+         * (1 byte) and the payload itself. The encoding is not portable,
+         * it is only meant to be read back by the same binary.
+         */
+        enum class RecordedEvent : std::uint8_t {
+            TestCaseStarting,
+            TestCasePartialStarting,
+            SectionStarting,
+            BenchmarkPreparing,
+            BenchmarkStarting,
+            BenchmarkEnded,
+            BenchmarkFailed,
+            AssertionStarting,
+            AssertionEnded,
+            SectionEnded,
+            TestCasePartialEnded,
+            TestCaseEnded,
+            FatalErrorEncountered,
+            //! Not a reporter event, carries a single user-provided number
+            Marker,
+        };
+
+        struct RecordedFrame {
+            RecordedEvent kind;
+            StringRef payload;
+        };
+
+        //! Appends a `Marker` frame carrying `value` to `out`
+        void appendMarkerFrame( std::string& out, std::uint64_t value );
+        //! Reads the value out of `Marker` frame's payload
+        std::uint64_t readMarkerFrame( StringRef payload );
+
+        /**
+         * Splits the next complete frame from `buffer`, starting at `pos`
+         *
+         * Returns false if there is no complete frame left in the buffer,
+         * otherwise fills in `frame` and advances `pos` past it.
+         */
+        bool nextRecordedFrame( StringRef buffer,
+                                std::size_t& pos,
+                                RecordedFrame& frame );
+
+        class IRecordedEventSink {
+        public:
+            virtual ~IRecordedEventSink(); // = default
+            //! Receives serialized events, can consume (clear) them
+            virtual void eventsRecorded( std::string& events ) = 0;
+        };
+
+        /**
+         * Serializes events from a single test run into frames, so that
+         * they can be replayed into the real reporter by `EventReplayer`,
+         * possibly in a different process.
+         *
+         * Only events that happen while running test cases are recorded.
+         * If there is a sink, the recorded events are handed to it whenever
+         * something interesting happens (anything but passed assertions),
+         * so that they are not lost if the test case crashes.
+         */
+        class EventRecorder final : public IEventListener {
+        public:
+            EventRecorder( IConfig const* config,
+                           ReporterPreferences const& preferences,
+                           IRecordedEventSink* sink );
+
+            //! Returns events recorded since the last call and clears them
+            std::string takeEvents();
+
+            void noMatchingTestCases( StringRef ) override {}
+            void reportInvalidTestSpec( StringRef ) override {}
+
+            void testRunStarting( TestRunInfo const& ) override {}
+            void testCaseStarting( TestCaseInfo const& testInfo ) override;
+            void testCasePartialStarting( TestCaseInfo const& testInfo,
+                                          uint64_t partNumber ) override;
+            void sectionStarting( SectionInfo const& sectionInfo ) override;
+
+            void benchmarkPreparing( StringRef name ) override;
+            void benchmarkStarting( BenchmarkInfo const& benchmarkInfo ) override;
+            void benchmarkEnded( BenchmarkStats<> const& benchmarkStats ) override;
+            void benchmarkFailed( StringRef error ) override;
+
+            void assertionStarting( AssertionInfo const& assertionInfo ) override;
+            void assertionEnded( AssertionStats const& assertionStats ) override;
+
+            void sectionEnded( SectionStats const& sectionStats ) override;
+            void testCasePartialEnded( TestCaseStats const& testCaseStats,
+                                       uint64_t partNumber ) override;
+            void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+            void testRunEnded( TestRunStats const& ) override {}
+
+            void skipTest( TestCaseInfo const& ) override {}
+            void testCaseCached( TestCaseInfo const& ) override {}
+            void fatalErrorEncountered( StringRef error ) override;
+
+            void listReporters( std::vector<ReporterDescription> const& ) override {}
+            void listListeners( std::vector<ListenerDescription> const& ) override {}
+            void listTests( std::vector<TestCaseHandle> const& ) override {}
+            void listTags( std::vector<TagInfo> const& ) override {}
+
+        private:
+            void flush();
+
+            std::string m_events;
+            IRecordedEventSink* m_sink;
+        };
+
+        /**
+         * Replays events recorded by `EventRecorder` into a reporter.
+         *
+         * Reporters are allowed to keep the stats they were given until
+         * the end of the test run, so the replayer owns the strings that
+         * the replayed stats refer to, and must outlive the test run.
+         */
+        class EventReplayer {
+        public:
+            explicit EventReplayer( IEventListener& target );
+
+            /**
+             * Replays events recorded for a single test case
+             *
+             * If the events end before the test case does, e.g. because
+             * the process running it has died, the test case is finished
+             * with a fatal error, with `abortMessage` as the message.
+             *
+             * Returns totals of the replayed test case.
+             */
+            Totals replayTestCase( TestCaseInfo const& testInfo,
+                                   StringRef events,
+                                   StringRef abortMessage );
+
+        private:
+            StringRef intern( std::string&& str );
+
+            IEventListener& m_target;
+            std::set<std::string> m_strings;
+        };
+
+    } // end namespace Detail
+} // end namespace Catch
+
+#endif // CATCH_EVENT_RECORDER_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_event_recorder.cpp (@wolfram77)
+#ifndef CATCH_EVENT_RECORDER_CPP_INCLUDED
+#define CATCH_EVENT_RECORDER_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_event_recorder.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../catch_assertion_result.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_section_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstring>
+#include <vector>
+
+namespace Catch {
+    namespace Detail {
+
+        namespace {
+
+            class FrameWriter {
+                std::string& m_out;
+                std::size_t m_start;
+
+            public:
+                FrameWriter( std::string& out, RecordedEvent kind ):
+                    m_out( out ), m_start( out.size() ) {
+                    m_out.append( sizeof( std::uint32_t ), '\0' );
+                    m_out.push_back( static_cast<char>( kind ) );
+                }
+                FrameWriter( FrameWriter const& ) = delete;
+                FrameWriter& operator=( FrameWriter const& ) = delete;
+
+                ~FrameWriter() {
+                    const auto payloadSize = static_cast<std::uint32_t>(
+                        m_out.size() - m_start - sizeof( std::uint32_t ) - 1 );
+                    std::memcpy( &m_out[m_start],
+                                 &payloadSize,
+                                 sizeof( payloadSize ) );
+                }
+
+                FrameWriter& operator<<( std::uint64_t value ) {
+                    m_out.append( reinterpret_cast<char const*>( &value ),
+                                  sizeof( value ) );
+                    return *this;
+                }
+                FrameWriter& operator<<( int value ) {
+                    return *this << static_cast<std::uint64_t>( value );
+                }
+                FrameWriter& operator<<( unsigned int value ) {
+                    return *this << static_cast<std::uint64_t>( value );
+                }
+                FrameWriter& operator<<( bool value ) {
+                    return *this << static_cast<std::uint64_t>( value );
+                }
+                FrameWriter& operator<<( double value ) {
+                    m_out.append( reinterpret_cast<char const*>( &value ),
+                                  sizeof( value ) );
+                    return *this;
+                }
+                FrameWriter& operator<<( StringRef str ) {
+                    *this << static_cast<std::uint64_t>( str.size() );
+                    m_out.append( str.data(), str.size() );
+                    return *this;
+                }
+                FrameWriter& operator<<( std::string const& str ) {
+                    return *this << StringRef( str );
+                }
+                FrameWriter& operator<<( char const* str ) {
+                    return *this << StringRef( str );
+                }
+                FrameWriter& operator<<( SourceLineInfo const& lineInfo ) {
+                    return *this << lineInfo.file
+                                 << static_cast<std::uint64_t>( lineInfo.line );
+                }
+                FrameWriter& operator<<( Counts const& counts ) {
+                    return *this << counts.passed << counts.failed
+                                 << counts.failedButOk << counts.skipped;
+                }
+                FrameWriter& operator<<( Totals const& totals ) {
+                    return *this << totals.assertions << totals.testCases;
+                }
+                FrameWriter& operator<<( SectionInfo const& info ) {
+                    return *this << info.name << info.lineInfo;
+                }
+                FrameWriter& operator<<( AssertionInfo const& info ) {
+                    return *this << info.macroName << info.lineInfo
+                                 << info.capturedExpression
+                                 << static_cast<std::uint64_t>(
+                                        info.resultDisposition );
+                }
+                FrameWriter& operator<<( MessageInfo const& info ) {
+                    return *this << info.macroName << info.lineInfo
+                                 << static_cast<std::uint64_t>( info.type )
+                                 << info.message << info.sequence;
+                }
+                FrameWriter& operator<<( BenchmarkInfo const& info ) {
+                    return *this << info.name << info.estimatedDuration
+                                 << info.iterations << info.samples
+                                 << info.resamples << info.clockResolution
+                                 << info.clockCost << info.family
+                                 << info.parameter << info.parameterValue
+                                 << info.coldCache << info.cpu;
+                }
+                FrameWriter& operator<<( BenchmarkCpuState const& cpu ) {
+                    return *this << cpu.cpu << cpu.pinned << cpu.model
+                                 << cpu.governor << cpu.frequency
+                                 << static_cast<std::uint64_t>( cpu.turbo );
+                }
+                FrameWriter&
+                operator<<( Benchmark::Estimate<Benchmark::FDuration> const& estimate ) {
+                    return *this << estimate.point.count()
+                                 << estimate.lower_bound.count()
+                                 << estimate.upper_bound.count()
+                                 << estimate.confidence_interval;
+                }
+                FrameWriter&
+                operator<<( Benchmark::OutlierClassification const& outliers ) {
+                    return *this << outliers.samples_seen << outliers.low_severe
+                                 << outliers.low_mild << outliers.high_mild
+                                 << outliers.high_severe;
+                }
+            };
+
+            class FrameReader {
+                char const* m_pos;
+                char const* m_end;
+
+                void ensureAvailable( std::size_t size ) const {
+                    CATCH_ENFORCE( static_cast<std::size_t>( m_end - m_pos ) >= size,
+                                   "Recorded event frame is truncated" );
+                }
+
+            public:
+                FrameReader( StringRef payload ):
+                    m_pos( payload.data() ),
+                    m_end( payload.data() + payload.size() ) {}
+
+                std::uint64_t readInt() {
+                    std::uint64_t value;
+                    ensureAvailable( sizeof( value ) );
+                    std::memcpy( &value, m_pos, sizeof( value ) );
+                    m_pos += sizeof( value );
+                    return value;
+                }
+                double readDouble() {
+                    double value;
+                    ensureAvailable( sizeof( value ) );
+                    std::memcpy( &value, m_pos, sizeof( value ) );
+                    m_pos += sizeof( value );
+                    return value;
+                }
+                bool readBool() { return readInt() != 0; }
+                std::string readString() {
+                    const auto size = static_cast<std::size_t>( readInt() );
+                    ensureAvailable( size );
+                    std::string str( m_pos, size );
+                    m_pos += size;
+                    return str;
+                }
+                Counts readCounts() {
+                    Counts counts;
+                    counts.passed = readInt();
+                    counts.failed = readInt();
+                    counts.failedButOk = readInt();
+                    counts.skipped = readInt();
+                    return counts;
+                }
+                Totals readTotals() {
+                    Totals totals;
+                    totals.assertions = readCounts();
+                    totals.testCases = readCounts();
+                    return totals;
+                }
+                BenchmarkInfo readBenchmarkInfo() {
+                    BenchmarkInfo info;
+                    info.name = readString();
+                    info.estimatedDuration = readDouble();
+                    info.iterations = static_cast<int>( readInt() );
+                    info.samples = static_cast<unsigned int>( readInt() );
+                    info.resamples = static_cast<unsigned int>( readInt() );
+                    info.clockResolution = readDouble();
+                    info.clockCost = readDouble();
+                    info.family = readString();
+                    info.parameter = readString();
+                    info.parameterValue = readInt();
+                    info.coldCache = readBool();
+                    info.cpu.cpu = static_cast<int>( readInt() );
+                    info.cpu.pinned = readBool();
+                    info.cpu.model = readString();
+                    info.cpu.governor = readString();
+                    info.cpu.frequency = readDouble();
+                    info.cpu.turbo = static_cast<TurboBoost>( readInt() );
+                    return info;
+                }
+                Benchmark::Estimate<Benchmark::FDuration> readEstimate() {
+                    Benchmark::Estimate<Benchmark::FDuration> estimate;
+                    estimate.point = Benchmark::FDuration( readDouble() );
+                    estimate.lower_bound = Benchmark::FDuration( readDouble() );
+                    estimate.upper_bound = Benchmark::FDuration( readDouble() );
+                    estimate.confidence_interval = readDouble();
+                    return estimate;
+                }
+                Benchmark::OutlierClassification readOutliers() {
+                    Benchmark::OutlierClassification outliers;
+                    outliers.samples_seen = static_cast<int>( readInt() );
+                    outliers.low_severe = static_cast<int>( readInt() );
+                    outliers.low_mild = static_cast<int>( readInt() );
+                    outliers.high_mild = static_cast<int>( readInt() );
+                    outliers.high_severe = static_cast<int>( readInt() );
+                    return outliers;
+                }
+            };
+
+        } // end unnamed namespace
+
+        void appendMarkerFrame( std::string& out, std::uint64_t value ) {
+            FrameWriter( out, RecordedEvent::Marker ) << value;
+        }
+
+        std::uint64_t readMarkerFrame( StringRef payload ) {
+            return FrameReader( payload ).readInt();
+        }
+
+        bool nextRecordedFrame( StringRef buffer,
+                                std::size_t& pos,
+                                RecordedFrame& frame ) {
+            constexpr std::size_t headerSize = sizeof( std::uint32_t ) + 1;
+            if ( buffer.size() - pos < headerSize ) {
+                return false;
+            }
+            std::uint32_t payloadSize;
+            std::memcpy( &payloadSize, buffer.data() + pos, sizeof( payloadSize ) );
+            if ( buffer.size() - pos - headerSize < payloadSize ) {
+                return false;
+            }
+            frame.kind = static_cast<RecordedEvent>(
+                buffer.data()[pos + sizeof( std::uint32_t )] );
+            frame.payload = StringRef( buffer.data() + pos + headerSize, payloadSize );
+            pos += headerSize + payloadSize;
+            return true;
+        }
+
+        IRecordedEventSink::~IRecordedEventSink() = default;
+
+        EventRecorder::EventRecorder( IConfig const* config,
+                                      ReporterPreferences const& preferences,
+                                      IRecordedEventSink* sink ):
+            IEventListener( config ), m_sink( sink ) {
+            m_preferences = preferences;
+        }
+
+        std::string EventRecorder::takeEvents() {
+            std::string events;
+            events.swap( m_events );
+            return events;
+        }
+
+        void EventRecorder::flush() {
+            if ( m_sink && !m_events.empty() ) {
+                m_sink->eventsRecorded( m_events );
+            }
+        }
+
+        void EventRecorder::testCaseStarting( TestCaseInfo const& ) {
+            { FrameWriter( m_events, RecordedEvent::TestCaseStarting ); }
+            flush();
+        }
+        void EventRecorder::testCasePartialStarting( TestCaseInfo const&,
+                                                     uint64_t partNumber ) {
+            FrameWriter( m_events, RecordedEvent::TestCasePartialStarting )
+                << partNumber;
+        }
+        void EventRecorder::sectionStarting( SectionInfo const& sectionInfo ) {
+            FrameWriter( m_events, RecordedEvent::SectionStarting ) << sectionInfo;
+            flush();
+        }
+
+        void EventRecorder::benchmarkPreparing( StringRef name ) {
+            FrameWriter( m_events, RecordedEvent::BenchmarkPreparing ) << name;
+            flush();
+        }
+        void EventRecorder::benchmarkStarting( BenchmarkInfo const& benchmarkInfo ) {
+            FrameWriter( m_events, RecordedEvent::BenchmarkStarting )
+                << benchmarkInfo;
+            flush();
+        }
+        void EventRecorder::benchmarkEnded( BenchmarkStats<> const& benchmarkStats ) {
+            {
+                FrameWriter writer( m_events, RecordedEvent::BenchmarkEnded );
+                writer << benchmarkStats.info
+                       << static_cast<std::uint64_t>( benchmarkStats.samples.size() );
+                for ( auto const& sample : benchmarkStats.samples ) {
+                    writer << sample.count();
+                }
+                writer << benchmarkStats.mean << benchmarkStats.standardDeviation
+                       << benchmarkStats.outliers << benchmarkStats.outlierVariance
+                       << static_cast<std::uint64_t>( benchmarkStats.counters.size() );
+                for ( auto const& counter : benchmarkStats.counters ) {
+                    writer << counter.name << counter.value;
+                }
+                writer << static_cast<bool>( benchmarkStats.baselineRatio );
+                if ( benchmarkStats.baselineRatio ) {
+                    auto const& ratio = *benchmarkStats.baselineRatio;
+                    writer << ratio.point << ratio.lower_bound
+                           << ratio.upper_bound << ratio.confidence_interval;
+                }
+                writer << static_cast<bool>( benchmarkStats.scalingEfficiency );
+                if ( benchmarkStats.scalingEfficiency ) {
+                    writer << *benchmarkStats.scalingEfficiency;
+                }
+                writer << static_cast<bool>( benchmarkStats.complexity );
+                if ( benchmarkStats.complexity ) {
+                    auto const& fit = *benchmarkStats.complexity;
+                    writer << static_cast<std::uint64_t>( fit.complexity )
+                           << fit.coefficient << fit.rms;
+                }
+                writer << static_cast<bool>( benchmarkStats.frequencyDrift );
+                if ( benchmarkStats.frequencyDrift ) {
+                    writer << *benchmarkStats.frequencyDrift;
+                }
+                writer << static_cast<bool>( benchmarkStats.bytesPerSecond );
+                if ( benchmarkStats.bytesPerSecond ) {
+                    writer << *benchmarkStats.bytesPerSecond;
+                }
+                writer << static_cast<bool>( benchmarkStats.itemsPerSecond );
+                if ( benchmarkStats.itemsPerSecond ) {
+                    writer << *benchmarkStats.itemsPerSecond;
+                }
+                writer << static_cast<std::uint64_t>( benchmarkStats.userCounters.size() );
+                for ( auto const& counter : benchmarkStats.userCounters ) {
+                    writer << counter.name << counter.value
+                           << static_cast<std::uint64_t>( counter.mode );
+                }
+                writer << static_cast<std::uint64_t>( benchmarkStats.percentiles.size() );
+                for ( auto const& percentile : benchmarkStats.percentiles ) {
+                    writer << percentile.percentile << percentile.value;
+                }
+                writer << static_cast<std::uint64_t>( benchmarkStats.histogram.size() );
+                for ( auto const& bucket : benchmarkStats.histogram ) {
+                    writer << bucket.lowerBound << bucket.upperBound << bucket.count;
+                }
+                writer << static_cast<bool>( benchmarkStats.maxIteration );
+                if ( benchmarkStats.maxIteration ) {
+                    writer << benchmarkStats.maxIteration->count();
+                }
+                writer << static_cast<bool>( benchmarkStats.iterationJitter );
+                if ( benchmarkStats.iterationJitter ) {
+                    writer << benchmarkStats.iterationJitter->count();
+                }
+            }
+            flush();
+        }
+        void EventRecorder::benchmarkFailed( StringRef error ) {
+            FrameWriter( m_events, RecordedEvent::BenchmarkFailed ) << error;
+            flush();
+        }
+
+        void EventRecorder::assertionStarting( AssertionInfo const& assertionInfo ) {
+            FrameWriter( m_events, RecordedEvent::AssertionStarting )
+                << assertionInfo;
+        }
+        void EventRecorder::assertionEnded( AssertionStats const& assertionStats ) {
+            auto const& result = assertionStats.assertionResult;
+            {
+                FrameWriter writer( m_events, RecordedEvent::AssertionEnded );
+                writer << result.m_info
+                       << static_cast<std::uint64_t>( result.getResultType() )
+                       << result.m_resultData.message
+                       << result.m_resultData.reconstructExpression();
+                // The result's message is appended to the info messages
+                // by AssertionStats' constructor, so it will be appended
+                // again during replay.
+                auto messageCount = assertionStats.infoMessages.size();
+                if ( result.hasMessage() && messageCount > 0 ) {
+                    --messageCount;
+                }
+                writer << static_cast<std::uint64_t>( messageCount );
+                for ( std::size_t i = 0; i < messageCount; ++i ) {
+                    writer << assertionStats.infoMessages[i];
+                }
+                writer << assertionStats.totals;
+            }
+            if ( !result.isOk() ) {
+                flush();
+            }
+        }
+
+        void EventRecorder::sectionEnded( SectionStats const& sectionStats ) {
+            FrameWriter( m_events, RecordedEvent::SectionEnded )
+                << sectionStats.sectionInfo << sectionStats.assertions
+                << sectionStats.durationInSeconds
+                << sectionStats.missingAssertions;
+        }
+        void EventRecorder::testCasePartialEnded( TestCaseStats const& testCaseStats,
+                                                  uint64_t partNumber ) {
+            FrameWriter( m_events, RecordedEvent::TestCasePartialEnded )
+                << testCaseStats.totals << testCaseStats.stdOut
+                << testCaseStats.stdErr << testCaseStats.aborting << partNumber;
+            flush();
+        }
+        void EventRecorder::testCaseEnded( TestCaseStats const& testCaseStats ) {
+            FrameWriter( m_events, RecordedEvent::TestCaseEnded )
+                << testCaseStats.totals << testCaseStats.stdOut
+                << testCaseStats.stdErr << testCaseStats.aborting;
+            flush();
+        }
+
+        void EventRecorder::fatalErrorEncountered( StringRef error ) {
+            FrameWriter( m_events, RecordedEvent::FatalErrorEncountered ) << error;
+            flush();
+        }
+
+
+        EventReplayer::EventReplayer( IEventListener& target ):
+            m_target( target ) {}
+
+        StringRef EventReplayer::intern( std::string&& str ) {
+            return *m_strings.insert( CATCH_MOVE( str ) ).first;
+        }
+
+        Totals EventReplayer::replayTestCase( TestCaseInfo const& testInfo,
+                                              StringRef events,
+                                              StringRef abortMessage ) {
+            auto readLineInfo = [&]( FrameReader& reader ) {
+                auto file = intern( reader.readString() );
+                auto line = static_cast<std::size_t>( reader.readInt() );
+                // Interned strings are stored in std::string,
+                // thus they are null-terminated
+                return SourceLineInfo( file.data(), line );
+            };
+            auto readSectionInfo = [&]( FrameReader& reader ) {
+                auto name = reader.readString();
+                return SectionInfo( readLineInfo( reader ), CATCH_MOVE( name ) );
+            };
+            auto readAssertionInfo = [&]( FrameReader& reader ) {
+                auto macroName = intern( reader.readString() );
+                auto lineInfo = readLineInfo( reader );
+                auto capturedExpression = intern( reader.readString() );
+                auto disposition = static_cast<ResultDisposition::Flags>(
+                    reader.readInt() );
+                return AssertionInfo{
+                    macroName, lineInfo, capturedExpression, disposition };
+            };
+            auto readTestCaseStats = [&]( FrameReader& reader ) {
+                auto totals = reader.readTotals();
+                auto stdOut = reader.readString();
+                auto stdErr = reader.readString();
+                bool aborting = reader.readBool();
+                return TestCaseStats( testInfo,
+                                      totals,
+                                      CATCH_MOVE( stdOut ),
+                                      CATCH_MOVE( stdErr ),
+                                      aborting );
+            };
+
+            bool testCaseStarted = false;
+            bool partialRunOpen = false;
+            uint64_t partNumber = 0;
+            std::vector<SectionInfo> openSections;
+            SourceLineInfo lastLineInfo = testInfo.lineInfo;
+            Totals finishedPartialsTotals;
+            //! Assertions of the partial run that has not ended yet,
+            //! counted like `RunContext` does
+            Totals openPartialTotals;
+
+            std::size_t pos = 0;
+            RecordedFrame frame;
+            while ( nextRecordedFrame( events, pos, frame ) ) {
+                FrameReader reader( frame.payload );
+                switch ( frame.kind ) {
+                case RecordedEvent::TestCaseStarting:
+                    testCaseStarted = true;
+                    m_target.testCaseStarting( testInfo );
+                    break;
+                case RecordedEvent::TestCasePartialStarting:
+                    partialRunOpen = true;
+                    partNumber = reader.readInt();
+                    m_target.testCasePartialStarting( testInfo, partNumber );
+                    break;
+                case RecordedEvent::SectionStarting: {
+                    openSections.push_back( readSectionInfo( reader ) );
+                    lastLineInfo = openSections.back().lineInfo;
+                    m_target.sectionStarting( openSections.back() );
+                    break;
+                }
+                case RecordedEvent::BenchmarkPreparing:
+                    m_target.benchmarkPreparing( intern( reader.readString() ) );
+                    break;
+                case RecordedEvent::BenchmarkStarting: {
+                    m_target.benchmarkStarting( reader.readBenchmarkInfo() );
+                    break;
+                }
+                case RecordedEvent::BenchmarkEnded: {
+                    BenchmarkStats<> stats;
+                    stats.info = reader.readBenchmarkInfo();
+                    const auto sampleCount = reader.readInt();
+                    stats.samples.reserve( static_cast<std::size_t>( sampleCount ) );
+                    for ( std::uint64_t i = 0; i < sampleCount; ++i ) {
+                        stats.samples.emplace_back( reader.readDouble() );
+                    }
+                    stats.mean = reader.readEstimate();
+                    stats.standardDeviation = reader.readEstimate();
+                    stats.outliers = reader.readOutliers();
+                    stats.outlierVariance = reader.readDouble();
+                    const auto counterCount = reader.readInt();
+                    stats.counters.reserve( static_cast<std::size_t>( counterCount ) );
+                    for ( std::uint64_t i = 0; i < counterCount; ++i ) {
+                        auto name = reader.readString();
+                        stats.counters.push_back( { CATCH_MOVE( name ), reader.readDouble() } );
+                    }
+                    if ( reader.readBool() ) {
+                        Benchmark::Estimate<double> ratio;
+                        ratio.point = reader.readDouble();
+                        ratio.lower_bound = reader.readDouble();
+                        ratio.upper_bound = reader.readDouble();
+                        ratio.confidence_interval = reader.readDouble();
+                        stats.baselineRatio = ratio;
+                    }
+                    if ( reader.readBool() ) {
+                        stats.scalingEfficiency = reader.readDouble();
+                    }
+                    if ( reader.readBool() ) {
+                        Benchmark::ComplexityFit fit;
+                        fit.complexity =
+                            static_cast<Benchmark::Complexity>( reader.readInt() );
+                        fit.coefficient = reader.readDouble();
+                        fit.rms = reader.readDouble();
+                        stats.complexity = fit;
+                    }
+                    if ( reader.readBool() ) {
+                        stats.frequencyDrift = reader.readDouble();
+                    }
+                    if ( reader.readBool() ) {
+                        stats.bytesPerSecond = reader.readDouble();
+                    }
+                    if ( reader.readBool() ) {
+                        stats.itemsPerSecond = reader.readDouble();
+                    }
+                    const auto userCounterCount = reader.readInt();
+                    stats.userCounters.reserve( static_cast<std::size_t>( userCounterCount ) );
+                    for ( std::uint64_t i = 0; i < userCounterCount; ++i ) {
+                        auto name = reader.readString();
+                        const double value = reader.readDouble();
+                        const auto mode =
+                            static_cast<Benchmark::CounterMode>( reader.readInt() );
+                        stats.userCounters.push_back( { CATCH_MOVE( name ), value, mode } );
+                    }
+                    const auto percentileCount = reader.readInt();
+                    stats.percentiles.reserve( static_cast<std::size_t>( percentileCount ) );
+                    for ( std::uint64_t i = 0; i < percentileCount; ++i ) {
+                        const double percentile = reader.readDouble();
+                        stats.percentiles.push_back( { percentile, reader.readEstimate() } );
+                    }
+                    const auto bucketCount = reader.readInt();
+                    stats.histogram.reserve( static_cast<std::size_t>( bucketCount ) );
+                    for ( std::uint64_t i = 0; i < bucketCount; ++i ) {
+                        const double lowerBound = reader.readDouble();
+                        const double upperBound = reader.readDouble();
+                        stats.histogram.push_back( { lowerBound, upperBound, reader.readInt() } );
+                    }
+                    if ( reader.readBool() ) {
+                        stats.maxIteration = Benchmark::FDuration( reader.readDouble() );
+                    }
+                    if ( reader.readBool() ) {
+                        stats.iterationJitter = Benchmark::FDuration( reader.readDouble() );
+                    }
+                    m_target.benchmarkEnded( stats );
+                    break;
+                }
+                case RecordedEvent::BenchmarkFailed:
+                    m_target.benchmarkFailed( intern( reader.readString() ) );
+                    break;
+                case RecordedEvent::AssertionStarting:
+                    m_target.assertionStarting( readAssertionInfo( reader ) );
+                    break;
+                case RecordedEvent::AssertionEnded: {
+                    auto info = readAssertionInfo( reader );
+                    lastLineInfo = info.lineInfo;
+                    auto resultType =
+                        static_cast<ResultWas::OfType>( reader.readInt() );
+                    AssertionResultData data( resultType, LazyExpression( false ) );
+                    data.message = reader.readString();
+                    data.reconstructedExpression = reader.readString();
+                    AssertionResult result( info, CATCH_MOVE( data ) );
+                    if ( resultType == ResultWas::Ok ) {
+                        openPartialTotals.assertions.passed++;
+                    } else if ( resultType == ResultWas::ExplicitSkip ) {
+                        openPartialTotals.assertions.skipped++;
+                    } else if ( !result.succeeded() && !result.isOk() ) {
+                        if ( testInfo.okToFail() ) {
+                            openPartialTotals.assertions.failedButOk++;
+                        } else {
+                            openPartialTotals.assertions.failed++;
+                        }
+                    }
+
+                    std::vector<MessageInfo> messages;
+                    const auto messageCount = reader.readInt();
+                    messages.reserve( static_cast<std::size_t>( messageCount ) );
+                    for ( std::uint64_t i = 0; i < messageCount; ++i ) {
+                        auto macroName = intern( reader.readString() );
+                        auto lineInfo = readLineInfo( reader );
+                        auto type = static_cast<ResultWas::OfType>( reader.readInt() );
+                        MessageInfo message( macroName, lineInfo, type );
+                        message.message = reader.readString();
+                        message.sequence = static_cast<unsigned int>( reader.readInt() );
+                        messages.push_back( CATCH_MOVE( message ) );
+                    }
+                    auto totals = reader.readTotals();
+                    m_target.assertionEnded( AssertionStats( result, messages, totals ) );
+                    break;
+                }
+                case RecordedEvent::SectionEnded: {
+                    auto sectionInfo = readSectionInfo( reader );
+                    auto assertions = reader.readCounts();
+                    auto duration = reader.readDouble();
+                    bool missingAssertions = reader.readBool();
+                    if ( !openSections.empty() ) {
+                        openSections.pop_back();
+                    }
+                    m_target.sectionEnded( SectionStats( CATCH_MOVE( sectionInfo ),
+                                                         assertions,
+                                                         duration,
+                                                         missingAssertions ) );
+                    break;
+                }
+                case RecordedEvent::TestCasePartialEnded: {
+                    auto stats = readTestCaseStats( reader );
+                    partialRunOpen = false;
+                    finishedPartialsTotals += stats.totals;
+                    openPartialTotals = Totals();
+                    m_target.testCasePartialEnded( stats, reader.readInt() );
+                    break;
+                }
+                case RecordedEvent::TestCaseEnded: {
+                    auto stats = readTestCaseStats( reader );
+                    m_target.testCaseEnded( stats );
+                    return stats.totals;
+                }
+                case RecordedEvent::FatalErrorEncountered:
+                    m_target.fatalErrorEncountered( intern( reader.readString() ) );
+                    break;
+                case RecordedEvent::Marker:
+                    break;
+                }
+            }
+
+            // The recorded events stop in the middle of the test case, so we
+            // close it the same way RunContext closes test cases that hit
+            // a fatal error condition.
+            if ( !testCaseStarted ) {
+                m_target.testCaseStarting( testInfo );
+            }
+            if ( !partialRunOpen ) {
+                m_target.testCasePartialStarting( testInfo, partNumber );
+            }
+            if ( openSections.empty() ) {
+                openSections.emplace_back( testInfo.lineInfo, testInfo.name );
+                m_target.sectionStarting( openSections.back() );
+            }
+            m_target.fatalErrorEncountered( abortMessage );
+
+            // Assertions the reporter was already shown count, on top of
+            // the failure the test case ends with
+            Totals partialTotals = openPartialTotals;
+            partialTotals.assertions.failed++;
+            Totals totals = finishedPartialsTotals;
+            totals += partialTotals;
+            totals.testCases = Counts();
+            totals.testCases.failed = 1;
+
+            const bool testCaseJustStarted = lastLineInfo == testInfo.lineInfo;
+            AssertionInfo info{
+                testCaseJustStarted ? "TEST_CASE"_sr : StringRef(),
+                lastLineInfo,
+                testCaseJustStarted
+                    ? StringRef()
+                    : "{Unknown expression after the reported line}"_sr,
+                ResultDisposition::Normal };
+            AssertionResultData data( ResultWas::FatalErrorCondition,
+                                      LazyExpression( false ) );
+            data.message = static_cast<std::string>( abortMessage );
+            m_target.assertionEnded( AssertionStats(
+                AssertionResult( info, CATCH_MOVE( data ) ), {}, totals ) );
+
+            while ( !openSections.empty() ) {
+                Counts assertions;
+                if ( openSections.size() == 1 ) {
+                    assertions = partialTotals.assertions;
+                }
+                m_target.sectionEnded( SectionStats(
+                    CATCH_MOVE( openSections.back() ), assertions, 0, false ) );
+                openSections.pop_back();
+            }
+
+            m_target.testCasePartialEnded(
+                TestCaseStats( testInfo, partialTotals, {}, {}, false ),
+                partNumber );
+            m_target.testCaseEnded(
+                TestCaseStats( testInfo, totals, {}, {}, false ) );
+            return totals;
+        }
+
+    } // end namespace Detail
+} // end namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_EVENT_RECORDER_CPP_INCLUDED
+// END Amalgamated content from catch_event_recorder.cpp (@wolfram77)
@@ -0,0 +1,301 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_PERSISTENT_FILE_HPP_INCLUDED
+#define CATCH_PERSISTENT_FILE_HPP_INCLUDED
+
+#include "catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stringref.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <string>
+
+namespace Catch {
+    namespace Detail {
+
+        /**
+         * Read-only view of the contents of a file
+         *
+         * The file is memory mapped where supported, otherwise it is read
+         * into memory. The contents are not guaranteed to be aligned.
+         */
+        class MappedFile : NonCopyable {
+        public:
+            //! Missing or unreadable file results in empty contents
+            explicit MappedFile( std::string const& path );
+            ~MappedFile();
+
+            StringRef contents() const { return m_contents; }
+
+        private:
+            StringRef m_contents;
+            void* m_mapping = nullptr;
+            std::string m_buffer;
+        };
+
+        //! Reads the whole file into `contents`, returns false if the file
+        //! cannot be opened (e.g. because it does not exist yet)
+        bool readWholeFile( std::string const& path, std::string& contents );
+
+        /**
+         * Replaces contents of file at `path` with `contents`, so that
+         * readers see either the old or the new file, never a partial one
+         *
+         * Every call writes its own temporary file, so that concurrent
+         * writers do not mix their contents. Merging into the file needs
+         * a `FileLock` around reading and replacing it on top of this.
+         *
+         * Returns false if the file could not be written.
+         */
+        bool replaceFileAtomically( std::string const& path,
+                                    std::string const& contents );
+
+        /**
+         * Exclusive lock of a file shared by processes, held while it lives
+         *
+         * Processes that read, merge and replace the same file, e.g.
+         * shards of a test run, hold it over the whole update, so that
+         * none of them loses the updates of another. The lock is taken on
+         * the `.lock` file next to the file, because the file itself is
+         * replaced. Locking is best effort, if the lock file cannot be
+         * created or the platform has no locks, nothing is locked.
+         */
+        class FileLock : NonCopyable {
+        public:
+            explicit FileLock( std::string const& path );
+            ~FileLock();
+
+        private:
+            // Descriptor or handle of the lock file, whichever the
+            // platform uses
+            int m_fd = -1;
+            void* m_handle = nullptr;
+        };
+
+        //! Returns last modification time of the file in seconds since
+        //! epoch, or 0 if it is unknown
+        std::int64_t fileModificationTime( char const* path );
+
+    } // end namespace Detail
+} // end namespace Catch
+
+#endif // CATCH_PERSISTENT_FILE_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_persistent_file.cpp (@wolfram77)
+#ifndef CATCH_PERSISTENT_FILE_CPP_INCLUDED
+#define CATCH_PERSISTENT_FILE_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_persistent_file.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#if defined( CATCH_PLATFORM_LINUX ) || defined( CATCH_PLATFORM_MAC )
+#    define CATCH_INTERNAL_POSIX_FILES
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#elif defined( CATCH_PLATFORM_WINDOWS ) && !defined( CATCH_PLATFORM_WINDOWS_UWP )
+#    define CATCH_INTERNAL_WINDOWS_FILES
+#    include "catch_windows_h_proxy.hpp"  // Adjust to relative path (@wolfram77)
+#    include <process.h>
+#endif
+
+namespace Catch {
+    namespace Detail {
+        namespace {
+            //! Name no other writer of the file uses at the same time
+            std::string uniqueTempPath( std::string const& path ) {
+                static std::atomic<std::uint64_t> counter{ 0 };
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+                const auto process = static_cast<std::uint64_t>( ::getpid() );
+#elif defined( CATCH_INTERNAL_WINDOWS_FILES )
+                const auto process = static_cast<std::uint64_t>( ::_getpid() );
+#else
+                // Without process ids, the start time tells processes apart
+                static const auto process = static_cast<std::uint64_t>(
+                    std::chrono::steady_clock::now().time_since_epoch().count() );
+#endif
+                std::ostringstream name;
+                name << path << ".tmp." << process << '.' << counter++;
+                return name.str();
+            }
+
+            bool replaceFile( std::string const& from, std::string const& to ) {
+#if defined( CATCH_INTERNAL_WINDOWS_FILES )
+                return ::MoveFileExA( from.c_str(), to.c_str(),
+                                      MOVEFILE_REPLACE_EXISTING ) != 0;
+#else
+                if ( std::rename( from.c_str(), to.c_str() ) == 0 ) {
+                    return true;
+                }
+#    if defined( CATCH_INTERNAL_POSIX_FILES )
+                return false;
+#    else
+                // Renaming over an existing file fails on some platforms,
+                // so fall back to non-atomic replacement there
+                std::remove( to.c_str() );
+                return std::rename( from.c_str(), to.c_str() ) == 0;
+#    endif
+#endif
+            }
+        } // end unnamed namespace
+
+        MappedFile::MappedFile( std::string const& path ) {
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+            const int fd = ::open( path.c_str(), O_RDONLY );
+            if ( fd < 0 ) {
+                return;
+            }
+            struct stat info;
+            if ( ::fstat( fd, &info ) == 0 && info.st_size > 0 ) {
+                const auto size = static_cast<std::size_t>( info.st_size );
+                void* mapping =
+                    ::mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+                if ( mapping != MAP_FAILED ) {
+                    m_mapping = mapping;
+                    m_contents =
+                        StringRef( static_cast<char const*>( mapping ), size );
+                }
+            }
+            ::close( fd );
+#else
+            if ( readWholeFile( path, m_buffer ) ) {
+                m_contents = m_buffer;
+            }
+#endif
+        }
+
+        MappedFile::~MappedFile() {
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+            if ( m_mapping ) {
+                ::munmap( m_mapping, m_contents.size() );
+            }
+#endif
+        }
+
+        bool readWholeFile( std::string const& path, std::string& contents ) {
+            std::ifstream in( path, std::ios::binary );
+            if ( !in ) {
+                return false;
+            }
+            std::ostringstream buffer;
+            buffer << in.rdbuf();
+            contents = buffer.str();
+            return true;
+        }
+
+        bool replaceFileAtomically( std::string const& path,
+                                    std::string const& contents ) {
+            const std::string tempPath = uniqueTempPath( path );
+            {
+                std::ofstream out( tempPath, std::ios::binary | std::ios::trunc );
+                if ( !out ) {
+                    return false;
+                }
+                out.write( contents.data(),
+                           static_cast<std::streamsize>( contents.size() ) );
+                out.flush();
+                if ( !out ) {
+                    std::remove( tempPath.c_str() );
+                    return false;
+                }
+            }
+            if ( replaceFile( tempPath, path ) ) {
+                return true;
+            }
+            std::remove( tempPath.c_str() );
+            return false;
+        }
+
+        FileLock::FileLock( std::string const& path ) {
+            const std::string lockPath = path + ".lock";
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+            m_fd = ::open( lockPath.c_str(), O_RDWR | O_CREAT, 0666 );
+            if ( m_fd < 0 ) {
+                return;
+            }
+            struct flock lock = {};
+            lock.l_type = F_WRLCK;
+            lock.l_whence = SEEK_SET;
+            while ( ::fcntl( m_fd, F_SETLKW, &lock ) != 0 ) {
+                if ( errno != EINTR ) {
+                    ::close( m_fd );
+                    m_fd = -1;
+                    return;
+                }
+            }
+#elif defined( CATCH_INTERNAL_WINDOWS_FILES )
+            HANDLE handle = ::CreateFileA( lockPath.c_str(),
+                                           GENERIC_READ | GENERIC_WRITE,
+                                           FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                           nullptr,
+                                           OPEN_ALWAYS,
+                                           FILE_ATTRIBUTE_NORMAL,
+                                           nullptr );
+            if ( handle == INVALID_HANDLE_VALUE ) {
+                return;
+            }
+            OVERLAPPED overlapped = {};
+            if ( !::LockFileEx( handle, LOCKFILE_EXCLUSIVE_LOCK, 0, 1, 0, &overlapped ) ) {
+                ::CloseHandle( handle );
+                return;
+            }
+            m_handle = handle;
+#else
+            static_cast<void>( lockPath );
+#endif
+        }
+
+        FileLock::~FileLock() {
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+            // Closing the descriptor releases the lock
+            if ( m_fd >= 0 ) {
+                ::close( m_fd );
+            }
+#elif defined( CATCH_INTERNAL_WINDOWS_FILES )
+            if ( m_handle ) {
+                OVERLAPPED overlapped = {};
+                ::UnlockFileEx( m_handle, 0, 1, 0, &overlapped );
+                ::CloseHandle( m_handle );
+            }
+#endif
+        }
+
+        std::int64_t fileModificationTime( char const* path ) {
+#if defined( CATCH_INTERNAL_POSIX_FILES )
+            struct stat info;
+            if ( ::stat( path, &info ) == 0 ) {
+                return static_cast<std::int64_t>( info.st_mtime );
+            }
+#else
+            static_cast<void>( path );
+#endif
+            return 0;
+        }
+
+    } // end namespace Detail
+} // end namespace Catch
+
+#undef CATCH_INTERNAL_POSIX_FILES
+#undef CATCH_INTERNAL_WINDOWS_FILES
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_PERSISTENT_FILE_CPP_INCLUDED
+// END Amalgamated content from catch_persistent_file.cpp (@wolfram77)
@@ -20,6 +20,8 @@
 #include "catch_optional.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_thread_support.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_test_watchdog.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_unique_ptr.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <string>
 
@@ -30,10 +32,12 @@ namespace Catch {
     class IEventListener;
     using IEventListenerPtr = Detail::unique_ptr<IEventListener>;
     class OutputRedirect;
+    class BenchmarkBaseline;
 
     ///////////////////////////////////////////////////////////////////////////
 
-    class RunContext final : public IResultCapture {
+    class RunContext final : public IResultCapture,
+                             private ITestTimeoutHandler {
 
     public:
         RunContext( RunContext const& ) = delete;
@@ -45,6 +49,14 @@ namespace Catch {
 
         Totals runTest(TestCaseHandle const& testCase);
 
+        //! Adds totals of test cases that were run outside of this context,
+        //! e.g. in worker processes, to the totals of the test run
+        void addExternalTotals( Totals const& totals );
+
+        //! Fatal condition handling is process-wide, so only one context
+        //! can use it, and contexts running tests in other threads cannot
+        void disableFatalConditionHandling();
+
     public: // IResultCapture
 
         // Assertion handlers
@@ -126,12 +138,38 @@ namespace Catch {
 
         void populateReaction( AssertionReaction& reaction, bool has_normal_disposition );
 
+        //! Reports the warnings about the measurement of the benchmark
+        void reportBenchmarkWarnings( BenchmarkStats<> const& stats );
+        void benchmarkWarning( std::string&& message );
+
+        //! Reports the active test case as failed and exits the process
+        void handleTestTimeout( std::uint64_t armId ) override;
+
         // Creates dummy info for unexpected exceptions/fatal errors,
         // where we do not have the access to one, but we still need
         // to send one to the reporters.
         AssertionInfo makeDummyAssertionInfo();
 
     private:
+        AssertionInfo makeDummyAssertionInfo( SourceLineInfo const& lineInfo ) const;
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        using WatchdogLock = std::unique_lock<std::recursive_mutex>;
+#else
+        struct WatchdogLock {
+            WatchdogLock() {}
+            ~WatchdogLock() {}
+        };
+#endif
+        //! Keeps the watchdog from reporting a timeout of the active test
+        //! while the state the report is built from changes. Taken around
+        //! reporter calls, and changes of the active sections, line info
+        //! and assertion counts, by every thread of the test.
+        WatchdogLock lockAgainstWatchdog();
+        //! Activates or deactivates the output redirect of the test under
+        //! the watchdog lock, because the watchdog deactivates it to report
+        //! a timeout
+        void setOutputRedirectActive( bool active );
 
         void handleUnfinishedSections();
         mutable Detail::Mutex m_assertionMutex;
@@ -147,7 +185,27 @@ namespace Catch {
         std::vector<ITracker*> m_activeSections;
         TrackerContext m_trackerContext;
         Detail::unique_ptr<OutputRedirect> m_outputRedirect;
-        FatalConditionHandler m_fatalConditionhandler;
+        // Created when the first test case is run, because only one handler
+        // can exist at a time, and not every context runs tests itself.
+        Detail::unique_ptr<FatalConditionHandler> m_fatalConditionhandler;
+        bool m_handleFatalConditions = true;
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        Detail::unique_ptr<TestWatchdog> m_watchdog;
+        // Recursive, because fatal errors are reported from signal handlers
+        // that may interrupt the test thread while it holds the lock
+        std::recursive_mutex m_watchdogMutex;
+        // Id of the watchdog arm of the running test, 0 if it is not armed,
+        // changed only under the watchdog lock
+        std::uint64_t m_watchdogArmId = 0;
+#endif
+        // Baseline the benchmarks are compared against, if any
+        Detail::unique_ptr<BenchmarkBaseline> m_comparedBaseline;
+        bool m_warnedAboutBaselineCpu = false;
+        // Timeout of the active test case in seconds, 0 if there is none
+        unsigned int m_activeTestTimeout = 0;
+        // Last known line info of the active test, changed only under the
+        // watchdog lock, so that the watchdog thread can read it
+        SourceLineInfo m_watchdogLineInfo{ "DummyLocation", static_cast<size_t>( -1 ) };
         // Caches m_config->abortAfter() to avoid vptr calls/allow inlining
         size_t m_abortAfterXFailedAssertions;
         bool m_shouldReportUnexpected = true;
@@ -161,6 +219,13 @@ namespace Catch {
 
     void seedRng(IConfig const& config);
     unsigned int rngSeed();
+
+    namespace Detail {
+        //! Returns timeout of the test case in seconds, 0 if it has none.
+        //! The `[timeout:N]` tag overrides the `--test-timeout` option.
+        unsigned int testTimeoutFor( IConfig const& config,
+                                     TestCaseInfo const& testInfo );
+    } // namespace Detail
 } // end namespace Catch
 
 #endif // CATCH_RUN_CONTEXT_HPP_INCLUDED
@@ -194,8 +259,16 @@ namespace Catch {
 #include "catch_test_failure_exception.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_thread_local.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_result_type.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_parse_numbers.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_reusable_string_stream.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_string_manip.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_benchmark_baseline.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_stats.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <cassert>
+#include <cstdlib>
 #include <algorithm>
 
 namespace Catch {
@@ -443,6 +516,22 @@ namespace Catch {
         }
         CATCH_INTERNAL_STOP_WARNINGS_SUPPRESSION
 
+        unsigned int testTimeoutFor( IConfig const& config,
+                                     TestCaseInfo const& testInfo ) {
+            const std::string timeoutPrefix = "timeout:";
+            for ( auto const& tag : testInfo.tags ) {
+                const auto tagName = static_cast<std::string>( tag.original );
+                if ( startsWith( tagName, timeoutPrefix ) ) {
+                    auto timeout =
+                        parseUInt( tagName.substr( timeoutPrefix.size() ) );
+                    if ( timeout ) {
+                        return *timeout;
+                    }
+                }
+            }
+            return config.testTimeout();
+        }
+
     } // namespace Detail
 
     RunContext::RunContext(IConfig const* _config, IEventListenerPtr&& reporter)
@@ -456,6 +545,10 @@ namespace Catch {
         m_shouldDebugBreak( m_config->shouldDebugBreak() )
     {
         getCurrentMutableContext().setResultCapture( this );
+        if ( !m_config->benchmarkCompareBaseline().empty() ) {
+            m_comparedBaseline = Detail::make_unique<BenchmarkBaseline>(
+                BenchmarkBaseline::pathFor( m_config->benchmarkCompareBaseline() ) );
+        }
         m_reporter->testRunStarting(m_runInfo);
 
         // TODO: HACK!
@@ -518,6 +611,22 @@ namespace Catch {
         //  it had when the generator for i was initialized.)
         seedRng( *m_config );
 
+        // Hung test cases are detected from the watchdog thread, which
+        // reports them through the same path as other fatal errors.
+        // Contexts that cannot handle fatal errors cannot handle hangs.
+        m_activeTestTimeout = Detail::testTimeoutFor( *m_config, testInfo );
+        m_watchdogLineInfo = testInfo.lineInfo;
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        if ( m_activeTestTimeout > 0 && m_handleFatalConditions ) {
+            if ( !m_watchdog ) {
+                m_watchdog = Detail::make_unique<TestWatchdog>();
+            }
+            auto watchdogLock = lockAgainstWatchdog();
+            m_watchdogArmId = m_watchdog->arm(
+                std::chrono::seconds( m_activeTestTimeout ), *this );
+        }
+#endif
+
         uint64_t testRuns = 0;
         std::string redirectedCout;
         std::string redirectedCerr;
@@ -525,7 +634,10 @@ namespace Catch {
             m_trackerContext.startCycle();
             m_testCaseTracker = &SectionTracker::acquire(m_trackerContext, TestCaseTracking::NameAndLocationRef(testInfo.name, testInfo.lineInfo));
 
-            m_reporter->testCasePartialStarting(testInfo, testRuns);
+            {
+                auto watchdogLock = lockAgainstWatchdog();
+                m_reporter->testCasePartialStarting(testInfo, testRuns);
+            }
 
             updateTotalsFromAtomics();
             const auto beforeRunTotals = m_totals;
@@ -539,11 +651,18 @@ namespace Catch {
             updateTotalsFromAtomics();
             const auto singleRunTotals = m_totals.delta(beforeRunTotals);
             auto statsForOneRun = TestCaseStats(testInfo, singleRunTotals, CATCH_MOVE(oneRunCout), CATCH_MOVE(oneRunCerr), aborting());
-            m_reporter->testCasePartialEnded(statsForOneRun, testRuns);
+            {
+                auto watchdogLock = lockAgainstWatchdog();
+                m_reporter->testCasePartialEnded(statsForOneRun, testRuns);
+            }
 
             ++testRuns;
         } while (!m_testCaseTracker->isSuccessfullyCompleted() && !aborting());
 
+        testCase.tearDownTestCase();
+        // A timeout reported just before the watchdog is disarmed must not
+        // see the test case end
+        auto watchdogLock = lockAgainstWatchdog();
         Totals deltaTotals = m_totals.delta(prevTotals);
         if (testInfo.expectedToFail() && deltaTotals.testCases.passed > 0) {
             deltaTotals.assertions.failed++;
@@ -551,7 +670,14 @@ namespace Catch {
             deltaTotals.testCases.failed++;
         }
         m_totals.testCases += deltaTotals.testCases;
-        testCase.tearDownTestCase();
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        if ( m_watchdog ) {
+            // The watchdog may already be calling the handler, which then
+            // waits for the lock and has to see that the test has ended
+            m_watchdogArmId = 0;
+            m_watchdog->disarm();
+        }
+#endif
         m_reporter->testCaseEnded(TestCaseStats(testInfo,
                                   deltaTotals,
                                   CATCH_MOVE(redirectedCout),
@@ -564,9 +690,126 @@ namespace Catch {
         return deltaTotals;
     }
 
+    void RunContext::addExternalTotals( Totals const& totals ) {
+        m_atomicAssertionCount.passed += totals.assertions.passed;
+        m_atomicAssertionCount.failed += totals.assertions.failed;
+        m_atomicAssertionCount.failedButOk += totals.assertions.failedButOk;
+        m_atomicAssertionCount.skipped += totals.assertions.skipped;
+        m_totals.testCases += totals.testCases;
+        updateTotalsFromAtomics();
+    }
+
+    void RunContext::disableFatalConditionHandling() {
+        m_handleFatalConditions = false;
+    }
+
+    RunContext::WatchdogLock RunContext::lockAgainstWatchdog() {
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        if ( m_watchdog && m_activeTestTimeout > 0 ) {
+            return WatchdogLock( m_watchdogMutex );
+        }
+#endif
+        return WatchdogLock();
+    }
+
+    void RunContext::setOutputRedirectActive( bool active ) {
+        auto watchdogLock = lockAgainstWatchdog();
+        if ( m_outputRedirect->isActive() == active ) {
+            return;
+        }
+        if ( active ) {
+            m_outputRedirect->activate();
+        } else {
+            m_outputRedirect->deactivate();
+        }
+    }
+
+    void RunContext::handleTestTimeout( std::uint64_t armId ) {
+#if defined( CATCH_CONFIG_USE_ASYNC )
+        // The test is still running, so the report is built only from the
+        // state the test changes under the watchdog lock. The lock is never
+        // released, so the test cannot report anything after the timeout.
+        m_watchdogMutex.lock();
+        if ( armId != m_watchdogArmId ) {
+            // The test ended while we waited for the lock
+            m_watchdogMutex.unlock();
+            return;
+        }
+        Detail::LockGuard lock( m_assertionMutex );
+
+        ReusableStringStream rss;
+        rss << "Test case timed out after "
+            << pluralise( m_activeTestTimeout, "second"_sr );
+        if ( !m_activeSections.empty() ) {
+            rss << " in section ";
+            for ( std::size_t i = 0; i < m_activeSections.size(); ++i ) {
+                if ( i > 0 ) {
+                    rss << " / ";
+                }
+                rss << '\'' << m_activeSections[i]->nameAndLocation().name
+                    << '\'';
+            }
+        }
+        const std::string message = rss.str();
+
+        // Like `handleFatalErrorCondition`, but without touching the line
+        // info, messages and trackers of the test threads
+        auto _ = scopedDeactivate( *m_outputRedirect );
+        m_reporter->fatalErrorEncountered( message );
+
+        AssertionResultData tempResult( ResultWas::FatalErrorCondition, { false } );
+        tempResult.message = message;
+        AssertionResult result( makeDummyAssertionInfo( m_watchdogLineInfo ),
+                                CATCH_MOVE( tempResult ) );
+        // The test threads update `m_totals` without the lock
+        Totals totals;
+        totals.assertions = Counts{
+            m_atomicAssertionCount.passed,
+            m_atomicAssertionCount.failed + 1,
+            m_atomicAssertionCount.failedButOk,
+            m_atomicAssertionCount.skipped,
+        };
+        totals.testCases = m_totals.testCases;
+        m_reporter->assertionEnded(
+            AssertionStats( result, std::vector<MessageInfo>(), totals ) );
+
+        Counts assertions;
+        assertions.failed = 1;
+        for ( auto it = m_activeSections.rbegin(); it != m_activeSections.rend();
+              ++it ) {
+            auto const& nl = ( *it )->nameAndLocation();
+            m_reporter->sectionEnded( SectionStats(
+                SectionInfo( nl.location, nl.name ), assertions, 0, false ) );
+        }
+
+        auto const& testInfo = m_activeTestCase->getTestCaseInfo();
+        m_reporter->sectionEnded(
+            SectionStats( SectionInfo( testInfo.lineInfo, testInfo.name ),
+                          assertions,
+                          0,
+                          false ) );
+
+        Totals deltaTotals;
+        deltaTotals.testCases.failed = 1;
+        deltaTotals.assertions.failed = 1;
+        m_reporter->testCaseEnded( TestCaseStats(
+            testInfo, deltaTotals, std::string(), std::string(), false ) );
+        totals.testCases.failed++;
+        m_reporter->testRunEnded( TestRunStats( m_runInfo, totals, false ) );
+
+        Catch::cout() << std::flush;
+        Catch::cerr() << std::flush;
+        std::_Exit( EXIT_FAILURE );
+#else
+        static_cast<void>( armId );
+#endif
+    }
+
 
     void RunContext::assertionEnded(AssertionResult&& result) {
+        auto watchdogLock = lockAgainstWatchdog();
         Detail::g_lastKnownLineInfo = result.m_info.lineInfo;
+        m_watchdogLineInfo = result.m_info.lineInfo;
         if (result.getResultType() == ResultWas::Ok) {
             m_atomicAssertionCount.passed++;
             Detail::g_lastAssertionPassed = true;
@@ -608,6 +851,7 @@ namespace Catch {
 
     void RunContext::notifyAssertionStarted( AssertionInfo const& info ) {
         if (m_reportAssertionStarting) {
+            auto watchdogLock = lockAgainstWatchdog();
             Detail::LockGuard lock( m_assertionMutex );
             auto _ = scopedDeactivate( *m_outputRedirect );
             m_reporter->assertionStarting( info );
@@ -624,10 +868,12 @@ namespace Catch {
 
         if (!sectionTracker.isOpen())
             return false;
+        auto watchdogLock = lockAgainstWatchdog();
         m_activeSections.push_back(&sectionTracker);
 
         SectionInfo sectionInfo( sectionLineInfo, static_cast<std::string>(sectionName) );
         Detail::g_lastKnownLineInfo = sectionLineInfo;
+        m_watchdogLineInfo = sectionLineInfo;
 
         {
             auto _ = scopedDeactivate( *m_outputRedirect );
@@ -684,6 +930,7 @@ namespace Catch {
     }
 
     void RunContext::sectionEnded(SectionEndInfo&& endInfo) {
+        auto watchdogLock = lockAgainstWatchdog();
         updateTotalsFromAtomics();
         Counts assertions = m_totals.assertions - endInfo.prevAssertions;
         bool missingAssertions = testForMissingAssertions(assertions);
@@ -704,6 +951,7 @@ namespace Catch {
     }
 
     void RunContext::sectionEndedEarly(SectionEndInfo&& endInfo) {
+        auto watchdogLock = lockAgainstWatchdog();
         if ( m_unfinishedSections.empty() ) {
             m_activeSections.back()->fail();
         } else {
@@ -715,18 +963,105 @@ namespace Catch {
     }
 
     void RunContext::benchmarkPreparing( StringRef name ) {
+        auto watchdogLock = lockAgainstWatchdog();
         auto _ = scopedDeactivate( *m_outputRedirect );
         m_reporter->benchmarkPreparing( name );
     }
     void RunContext::benchmarkStarting( BenchmarkInfo const& info ) {
+        auto watchdogLock = lockAgainstWatchdog();
         auto _ = scopedDeactivate( *m_outputRedirect );
         m_reporter->benchmarkStarting( info );
     }
     void RunContext::benchmarkEnded( BenchmarkStats<> const& stats ) {
-        auto _ = scopedDeactivate( *m_outputRedirect );
-        m_reporter->benchmarkEnded( stats );
+        auto const* baselineSamples =
+            m_comparedBaseline && m_activeTestCase && !stats.samples.empty()
+                ? m_comparedBaseline->find( m_activeTestCase->getTestCaseInfo(),
+                                            stats.info.name )
+                : nullptr;
+        if ( !baselineSamples ) {
+            {
+                auto watchdogLock = lockAgainstWatchdog();
+                auto _ = scopedDeactivate( *m_outputRedirect );
+                m_reporter->benchmarkEnded( stats );
+            }
+            reportBenchmarkWarnings( stats );
+            return;
+        }
+
+        std::vector<double> samples;
+        samples.reserve( stats.samples.size() );
+        for ( auto const& sample : stats.samples ) {
+            samples.push_back( sample.count() );
+        }
+        auto comparedStats = stats;
+        comparedStats.baselineRatio = Benchmark::Detail::bootstrap_mean_ratio(
+            m_config->benchmarkConfidenceInterval(),
+            m_config->benchmarkResamples(),
+            m_config->rngSeed(),
+            baselineSamples->data(),
+            baselineSamples->data() + baselineSamples->size(),
+            samples.data(),
+            samples.data() + samples.size() );
+        {
+            auto watchdogLock = lockAgainstWatchdog();
+            auto _ = scopedDeactivate( *m_outputRedirect );
+            m_reporter->benchmarkEnded( comparedStats );
+        }
+        reportBenchmarkWarnings( stats );
+
+        // Comparisons across machines or frequency scaling settings are
+        // allowed, but they rarely mean anything
+        const auto cpu = Benchmark::Detail::describeCpuState( stats.info.cpu );
+        if ( !m_warnedAboutBaselineCpu && !m_comparedBaseline->cpu().empty() &&
+             m_comparedBaseline->cpu() != cpu ) {
+            m_warnedAboutBaselineCpu = true;
+            benchmarkWarning( "Baseline '" + m_config->benchmarkCompareBaseline() +
+                              "' was recorded on " + m_comparedBaseline->cpu() +
+                              ", benchmarks now run on " + cpu );
+        }
+
+        // The slowdown has to be both significant (the whole confidence
+        // interval is above 1) and bigger than the allowed regression
+        auto const& ratio = *comparedStats.baselineRatio;
+        const double threshold = m_config->benchmarkRegressionThreshold();
+        if ( threshold < 0 || !( ratio.lower_bound > 1. ) ||
+             ( ratio.point - 1. ) * 100. <= threshold ) {
+            return;
+        }
+        ReusableStringStream rss;
+        rss << "Benchmark '" << stats.info.name << "' is "
+            << ( ratio.point - 1. ) * 100. << "% slower than baseline '"
+            << m_config->benchmarkCompareBaseline() << "' ("
+            << ratio.confidence_interval * 100. << "% CI: "
+            << ( ratio.lower_bound - 1. ) * 100. << "% to "
+            << ( ratio.upper_bound - 1. ) * 100.
+            << "%), allowed regression is " << threshold << '%';
+        AssertionReaction reaction;
+        handleMessage( AssertionInfo{ "BENCHMARK"_sr,
+                                      Detail::g_lastKnownLineInfo,
+                                      StringRef(),
+                                      ResultDisposition::ContinueOnFailure },
+                       ResultWas::ExplicitFailure,
+                       rss.str(),
+                       reaction );
+    }
+    void RunContext::reportBenchmarkWarnings( BenchmarkStats<> const& stats ) {
+        for ( auto const& warning : stats.warnings ) {
+            benchmarkWarning( std::string( warning ) );
+        }
+    }
+    void RunContext::benchmarkWarning( std::string&& message ) {
+        AssertionReaction reaction;
+        handleMessage( AssertionInfo{ "BENCHMARK"_sr,
+                                      Detail::g_lastKnownLineInfo,
+                                      StringRef(),
+                                      ResultDisposition::ContinueOnFailure },
+                       ResultWas::Warning,
+                       CATCH_MOVE( message ),
+                       reaction );
     }
     void RunContext::benchmarkFailed( StringRef error ) {
+        auto watchdogLock = lockAgainstWatchdog();
         auto _ = scopedDeactivate( *m_outputRedirect );
         m_reporter->benchmarkFailed( error );
     }
@@ -758,6 +1093,7 @@ namespace Catch {
     }
 
     void RunContext::handleFatalErrorCondition( StringRef message ) {
+        auto watchdogLock = lockAgainstWatchdog();
         // We lock only when touching the reporters directly, to avoid
         // deadlocks when we call into other functions that also want
         // to lock the mutex before touching reporters.
@@ -830,7 +1166,9 @@ namespace Catch {
 
     void RunContext::assertionPassedFastPath(SourceLineInfo lineInfo) {
         // We want to save the line info for better experience with unexpected assertions
+        auto watchdogLock = lockAgainstWatchdog();
         Detail::g_lastKnownLineInfo = lineInfo;
+        m_watchdogLineInfo = lineInfo;
         ++m_atomicAssertionCount.passed;
         Detail::g_lastAssertionPassed = true;
         Detail::g_clearMessageScopes = true;
@@ -852,7 +1190,10 @@ namespace Catch {
     void RunContext::runCurrentTest() {
         auto const& testCaseInfo = m_activeTestCase->getTestCaseInfo();
         SectionInfo testCaseSection(testCaseInfo.lineInfo, testCaseInfo.name);
-        m_reporter->sectionStarting(testCaseSection);
+        {
+            auto watchdogLock = lockAgainstWatchdog();
+            m_reporter->sectionStarting(testCaseSection);
+        }
         updateTotalsFromAtomics();
         Counts prevAssertions = m_totals.assertions;
         double duration = 0;
@@ -861,17 +1202,19 @@ namespace Catch {
 
         Timer timer;
         CATCH_TRY {
-            {
-                auto _ = scopedActivate( *m_outputRedirect );
-                timer.start();
-                invokeActiveTestCase();
-            }
+            setOutputRedirectActive( true );
+            timer.start();
+            invokeActiveTestCase();
+            setOutputRedirectActive( false );
             duration = timer.getElapsedSeconds();
         } CATCH_CATCH_ANON (TestFailureException&) {
             // This just means the test was aborted due to failure
+            setOutputRedirectActive( false );
         } CATCH_CATCH_ANON (TestSkipException&) {
             // This just means the test was explicitly skipped
+            setOutputRedirectActive( false );
         } CATCH_CATCH_ALL {
+            setOutputRedirectActive( false );
             // Under CATCH_CONFIG_FAST_COMPILE, unexpected exceptions under REQUIRE assertions
             // are reported without translation at the point of origin.
             if ( m_shouldReportUnexpected ) {
@@ -881,6 +1224,7 @@ namespace Catch {
                                                    dummyReaction );
             }
         }
+        auto watchdogLock = lockAgainstWatchdog();
         updateTotalsFromAtomics();
         Counts assertions = m_totals.assertions - prevAssertions;
         bool missingAssertions = testForMissingAssertions(assertions);
@@ -900,7 +1244,14 @@ namespace Catch {
         // We need to engage a handler for signals/structured exceptions
         // before running the tests themselves, or the binary can crash
         // without failed test being reported.
-        FatalConditionHandlerGuard _(&m_fatalConditionhandler);
+        if ( !m_handleFatalConditions ) {
+            m_activeTestCase->invoke();
+            return;
+        }
+        if ( !m_fatalConditionhandler ) {
+            m_fatalConditionhandler = Detail::make_unique<FatalConditionHandler>();
+        }
+        FatalConditionHandlerGuard _(m_fatalConditionhandler.get());
         // We keep having issue where some compilers warn about an unused
         // variable, even though the type has non-trivial constructor and
         // destructor. This is annoying and ugly, but it makes them stfu.
@@ -1012,13 +1363,17 @@ namespace Catch {
     }
 
     AssertionInfo RunContext::makeDummyAssertionInfo() {
+        return makeDummyAssertionInfo( Detail::g_lastKnownLineInfo );
+    }
+
+    AssertionInfo
+    RunContext::makeDummyAssertionInfo( SourceLineInfo const& lineInfo ) const {
         const bool testCaseJustStarted =
-            Detail::g_lastKnownLineInfo ==
-            m_activeTestCase->getTestCaseInfo().lineInfo;
+            lineInfo == m_activeTestCase->getTestCaseInfo().lineInfo;
 
         return AssertionInfo{
             testCaseJustStarted ? "TEST_CASE"_sr : StringRef(),
-            Detail::g_lastKnownLineInfo,
+            lineInfo,
             testCaseJustStarted ? StringRef() : "{Unknown expression after the reported line}"_sr,
             ResultDisposition::Normal
         };
@@ -0,0 +1,210 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_RUN_HISTORY_HPP_INCLUDED
+#define CATCH_RUN_HISTORY_HPP_INCLUDED
+
+#include "../reporters/catch_reporter_event_listener.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace Catch {
+
+    struct TestCaseInfo;
+
+    /**
+     * Results of test cases in the last few runs
+     *
+     * Only the last `maxRecordedRuns` results of every test case are kept,
+     * so the history file stays small. The file has one test case per
+     * line: `persistentTestCaseHash`, results from the oldest to the
+     * newest ('P' for pass, 'F' for failure), and the name of the test
+     * case (for humans only).
+     */
+    class RunHistory {
+    public:
+        static constexpr std::size_t maxRecordedRuns = 16;
+
+        RunHistory() = default;
+        //! Loads history from the file, missing file means no history
+        explicit RunHistory( std::string const& path );
+
+        /**
+         * Returns how urgently should the test case run, higher is sooner
+         *
+         * Tests that failed in the last run come first, followed by tests
+         * that failed in any of the recorded runs (e.g. flaky ones),
+         * ordered by the number of their failures.
+         */
+        std::uint64_t failurePriority( TestCaseInfo const& testInfo ) const;
+        void record( TestCaseInfo const& testInfo, bool passed );
+
+        /**
+         * Appends the recorded results to the history in the file, as
+         * it is by then, e.g. after other shards saved theirs
+         *
+         * Returns false if the history could not be written.
+         */
+        bool save( std::string const& path ) const;
+
+    private:
+        struct Results {
+            std::string results;
+            std::string name;
+        };
+        static void append( Results& entry, std::string const& name, std::string const& results );
+
+        std::map<std::uint64_t, Results> m_history;
+        //! Results recorded by this run
+        std::map<std::uint64_t, Results> m_recorded;
+    };
+
+    /**
+     * Appends results of the executed test cases to the run history file
+     * given by `IConfig::runHistoryFile`
+     */
+    class RunHistoryRecorder final : public EventListenerBase {
+    public:
+        RunHistoryRecorder( IConfig const* config );
+
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        RunHistory m_history;
+        bool m_recordedAny = false;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_RUN_HISTORY_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_run_history.cpp (@wolfram77)
+#ifndef CATCH_RUN_HISTORY_CPP_INCLUDED
+#define CATCH_RUN_HISTORY_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_run_history.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_test_case_info_hasher.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace Catch {
+
+    constexpr std::size_t RunHistory::maxRecordedRuns;
+
+    RunHistory::RunHistory( std::string const& path ) {
+        std::string contents;
+        if ( path.empty() || !Detail::readWholeFile( path, contents ) ) {
+            return;
+        }
+
+        std::istringstream in( contents );
+        std::string line;
+        while ( std::getline( in, line ) ) {
+            std::istringstream lineStream( line );
+            std::uint64_t hash;
+            std::string results;
+            if ( !( lineStream >> std::hex >> hash >> results ) ||
+                 results.find_first_not_of( "PF" ) != std::string::npos ) {
+                // Silently skip malformed lines, the file is only a hint
+                continue;
+            }
+            if ( results.size() > maxRecordedRuns ) {
+                results.erase( 0, results.size() - maxRecordedRuns );
+            }
+            std::string name;
+            std::getline( lineStream >> std::ws, name );
+            m_history[hash] = { CATCH_MOVE( results ), CATCH_MOVE( name ) };
+        }
+    }
+
+    std::uint64_t
+    RunHistory::failurePriority( TestCaseInfo const& testInfo ) const {
+        auto it = m_history.find( persistentTestCaseHash( testInfo ) );
+        if ( it == m_history.end() ) {
+            return 0;
+        }
+        auto const& results = it->second.results;
+        const auto failures = static_cast<std::uint64_t>(
+            std::count( results.begin(), results.end(), 'F' ) );
+        const bool failedLastRun = !results.empty() && results.back() == 'F';
+        return ( failedLastRun ? maxRecordedRuns + 1 : 0 ) + failures;
+    }
+
+    void RunHistory::append( Results& entry,
+                             std::string const& name,
+                             std::string const& results ) {
+        entry.name = name;
+        entry.results += results;
+        if ( entry.results.size() > maxRecordedRuns ) {
+            entry.results.erase( 0, entry.results.size() - maxRecordedRuns );
+        }
+    }
+
+    void RunHistory::record( TestCaseInfo const& testInfo, bool passed ) {
+        const auto hash = persistentTestCaseHash( testInfo );
+        const std::string result( 1, passed ? 'P' : 'F' );
+        append( m_history[hash], testInfo.name, result );
+        append( m_recorded[hash], testInfo.name, result );
+    }
+
+    bool RunHistory::save( std::string const& path ) const {
+        Detail::FileLock lock( path );
+        RunHistory merged( path );
+        for ( auto const& entry : m_recorded ) {
+            append( merged.m_history[entry.first], entry.second.name, entry.second.results );
+        }
+
+        std::ostringstream out;
+        for ( auto const& entry : merged.m_history ) {
+            out << std::hex << std::setw( 16 ) << std::setfill( '0' )
+                << entry.first << std::dec << ' ' << entry.second.results
+                << ' ' << entry.second.name << '\n';
+        }
+        return Detail::replaceFileAtomically( path, out.str() );
+    }
+
+    RunHistoryRecorder::RunHistoryRecorder( IConfig const* config ):
+        EventListenerBase( config ), m_history( config->runHistoryFile() ) {}
+
+    void RunHistoryRecorder::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        auto const& testCases = testCaseStats.totals.testCases;
+        // Skipped test cases tell us nothing about the code under test
+        if ( testCases.skipped > 0 ) {
+            return;
+        }
+        m_history.record( *testCaseStats.testInfo, testCases.failed == 0 );
+        m_recordedAny = true;
+    }
+
+    void RunHistoryRecorder::testRunEnded( TestRunStats const& ) {
+        if ( m_recordedAny && !m_history.save( m_config->runHistoryFile() ) ) {
+            Catch::cerr() << "Warning: could not write run history to '"
+                          << m_config->runHistoryFile() << "'\n";
+        }
+    }
+
+} // end namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_RUN_HISTORY_CPP_INCLUDED
+// END Amalgamated content from catch_run_history.cpp (@wolfram77)
@@ -10,6 +10,8 @@
 
 #include <cassert>
 #include <algorithm>
+#include <utility>
+#include <vector>
 
 namespace Catch {
 
@@ -35,6 +37,58 @@ namespace Catch {
         return Container(startIterator, endIterator);
     }
 
+    /**
+     * Splits the container into shards with roughly equal total weight
+     *
+     * Uses the LPT heuristic: elements are taken from the heaviest
+     * to the lightest, and each is assigned to the currently lightest
+     * shard. Ties are broken by the original position of the element
+     * and by the shard index, so all shards compute the same split.
+     *
+     * The elements of the returned shard keep their original order.
+     */
+    template<typename Container, typename WeightFunction>
+    Container createBalancedShard(Container const& container, std::size_t const shardCount, std::size_t const shardIndex, WeightFunction&& weightOf) {
+        assert(shardCount > shardIndex);
+
+        if (shardCount == 1) {
+            return container;
+        }
+
+        std::vector<std::pair<double, std::size_t>> weighted;
+        weighted.reserve(container.size());
+        for (auto const& element : container) {
+            weighted.emplace_back(weightOf(element), weighted.size());
+        }
+        std::sort(weighted.begin(), weighted.end(),
+                  [](std::pair<double, std::size_t> const& lhs,
+                     std::pair<double, std::size_t> const& rhs) {
+                      if (lhs.first != rhs.first) {
+                          return lhs.first > rhs.first;
+                      }
+                      return lhs.second < rhs.second;
+                  });
+
+        std::vector<double> shardLoads(shardCount, 0.);
+        std::vector<bool> inShard(container.size(), false);
+        for (auto const& element : weighted) {
+            auto lightest = std::min_element(shardLoads.begin(), shardLoads.end());
+            *lightest += element.first;
+            if (static_cast<std::size_t>(lightest - shardLoads.begin()) == shardIndex) {
+                inShard[element.second] = true;
+            }
+        }
+
+        std::vector<typename Container::value_type> shard;
+        std::size_t index = 0;
+        for (auto const& element : container) {
+            if (inShard[index++]) {
+                shard.push_back(element);
+            }
+        }
+        return Container(shard.begin(), shard.end());
+    }
+
 }
 
 #endif // CATCH_SHARDING_HPP_INCLUDED
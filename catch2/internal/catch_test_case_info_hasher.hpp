@@ -23,6 +23,15 @@ namespace Catch {
         hash_t m_seed;
     };
 
+    /**
+     * Returns hash of test case's identity (name, class name and tags)
+     * that is stable across runs and builds
+     *
+     * Unlike `TestCaseInfoHasher`, the result is not truncated, so it is
+     * suitable for keying data that is persisted between runs.
+     */
+    std::uint64_t persistentTestCaseHash( TestCaseInfo const& t );
+
 } // namespace Catch
 
 #endif /* CATCH_TEST_CASE_INFO_HASHER_HPP_INCLUDED */
@@ -70,6 +79,27 @@ namespace Catch {
         const uint32_t high{ static_cast<uint32_t>( hash >> 32 ) };
         return low * high;
     }
+
+    std::uint64_t persistentTestCaseHash( TestCaseInfo const& t ) {
+        const std::uint64_t prime = 1099511628211u;
+        std::uint64_t hash = 14695981039346656037u;
+        auto hashString = [&]( StringRef str ) {
+            for ( const char c : str ) {
+                hash ^= static_cast<unsigned char>( c );
+                hash *= prime;
+            }
+            // Separates the fields, so that e.g. moving a character from
+            // the name to the class name changes the hash
+            hash ^= 0xFFu;
+            hash *= prime;
+        };
+        hashString( t.name );
+        hashString( t.className );
+        for ( const Tag& tag : t.tags ) {
+            hashString( tag.original );
+        }
+        return hash;
+    }
 } // namespace Catch
 #endif // CATCH2_IMPLEMENTATION
 #endif // CATCH_TEST_CASE_INFO_HASHER_CPP_INCLUDED
@@ -74,14 +74,19 @@ namespace Catch {
 #include "catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_registry_hub.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_run_history.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_sharding.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_test_timings.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_test_spec.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 #include "catch_test_case_info_hasher.hpp"  // Adjust to relative path (@wolfram77)
 
 #include <algorithm>
+#include <map>
 #include <set>
+#include <tuple>
 
 namespace Catch {
 
@@ -163,6 +168,49 @@ namespace Catch {
 
             return randomized;
         }
+        case TestRunOrder::FailedFirst: {
+            // Tests from the same file share the modification time,
+            // so we look it up only once per file.
+            RunHistory const history( config.runHistoryFile() );
+            std::map<std::string, std::int64_t> fileModificationTimes;
+            auto modificationTime = [&]( TestCaseInfo const& info ) {
+                auto it = fileModificationTimes.find( info.lineInfo.file );
+                if ( it == fileModificationTimes.end() ) {
+                    it = fileModificationTimes
+                             .emplace( info.lineInfo.file,
+                                       Detail::fileModificationTime(
+                                           info.lineInfo.file ) )
+                             .first;
+                }
+                return it->second;
+            };
+
+            using TestWithPriority =
+                std::pair<std::tuple<std::uint64_t, std::int64_t>, TestCaseHandle>;
+            std::vector<TestWithPriority> prioritized;
+            prioritized.reserve( unsortedTestCases.size() );
+            for ( auto const& handle : unsortedTestCases ) {
+                auto const& info = handle.getTestCaseInfo();
+                prioritized.emplace_back(
+                    std::make_tuple( history.failurePriority( info ),
+                                     modificationTime( info ) ),
+                    handle );
+            }
+
+            std::stable_sort(
+                prioritized.begin(),
+                prioritized.end(),
+                []( TestWithPriority const& lhs, TestWithPriority const& rhs ) {
+                    return lhs.first > rhs.first;
+                } );
+
+            std::vector<TestCaseHandle> sorted;
+            sorted.reserve( prioritized.size() );
+            for ( auto const& test : prioritized ) {
+                sorted.push_back( test.second );
+            }
+            return sorted;
+        }
         }
 
         CATCH_INTERNAL_ERROR("Unknown test order value!");
@@ -181,6 +229,16 @@ namespace Catch {
                 filtered.push_back(testCase);
             }
         }
+        if ( config.shardStrategy() == ShardStrategy::Balanced ) {
+            TestTimings const timings( config.testTimingsFile() );
+            return createBalancedShard(
+                filtered,
+                config.shardCount(),
+                config.shardIndex(),
+                [&]( TestCaseHandle const& test ) {
+                    return timings.estimate( test.getTestCaseInfo() );
+                } );
+        }
         return createShard(filtered, config.shardCount(), config.shardIndex());
     }
     std::vector<TestCaseHandle> const& getAllTestCasesSorted( IConfig const& config ) {
@@ -0,0 +1,295 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_TEST_RESULT_CACHE_HPP_INCLUDED
+#define CATCH_TEST_RESULT_CACHE_HPP_INCLUDED
+
+#include "../reporters/catch_reporter_event_listener.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace Catch {
+
+    struct TestCaseInfo;
+
+    /**
+     * Computes fingerprint of the build under test
+     *
+     * If `cacheKey` is not empty, the fingerprint is derived only from it.
+     * Otherwise it is the hash of the executable, found via `processName`
+     * (or the OS, where it can tell). Returns 0 if the executable cannot
+     * be read.
+     */
+    std::uint64_t computeBuildFingerprint( std::string const& cacheKey,
+                                           std::string const& processName );
+
+    /**
+     * Remembers which test cases passed with a specific build
+     *
+     * The cache file is a header (magic, build fingerprint, entry count),
+     * followed by sorted `persistentTestCaseHash`es of the passed test
+     * cases. It is memory mapped and searched in place, so that opening
+     * even a big cache is cheap. Contents cached for a different build
+     * fingerprint are ignored.
+     */
+    class TestResultCache {
+    public:
+        TestResultCache( std::string path, std::uint64_t buildFingerprint );
+
+        //! Did the test case pass in a previous run of the same build?
+        bool hasPassed( TestCaseInfo const& testInfo ) const;
+        void recordResult( TestCaseInfo const& testInfo, bool passed );
+
+        /**
+         * Writes out the recorded results merged with the passes cached
+         * in the file by then, e.g. by other shards
+         *
+         * Returns false if the cache could not be written.
+         */
+        bool save() const;
+
+    private:
+        bool containsPass( std::uint64_t testHash ) const;
+
+        std::string m_path;
+        std::uint64_t m_buildFingerprint;
+        Detail::MappedFile m_file;
+        //! Part of the mapped file with the hashes of passed test cases
+        char const* m_entries = nullptr;
+        std::size_t m_entryCount = 0;
+        std::map<std::uint64_t, bool> m_recordedResults;
+    };
+
+    /**
+     * Records results of the executed test cases into the result cache
+     *
+     * Test cases that did not run are left as they were in the cache,
+     * so filtered and sharded runs keep the results of other tests.
+     *
+     * Runs that leave out parts of test cases, e.g. sections not picked
+     * by `-c`, record only failures, because their passes do not mean
+     * that the whole test case passes.
+     */
+    class TestResultCacheRecorder final : public EventListenerBase {
+    public:
+        TestResultCacheRecorder( IConfig const* config,
+                                 TestResultCache& cache );
+
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        TestResultCache& m_cache;
+        bool m_recordPasses;
+        bool m_recordedAny = false;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_TEST_RESULT_CACHE_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_test_result_cache.cpp (@wolfram77)
+#ifndef CATCH_TEST_RESULT_CACHE_CPP_INCLUDED
+#define CATCH_TEST_RESULT_CACHE_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_test_result_cache.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_platform.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_test_case_info_hasher.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Catch {
+
+    namespace {
+        constexpr char cacheMagic[8] = { 'C', 'A', 'T', 'C', 'H', 'R', 'C', '1' };
+        constexpr std::size_t cacheHeaderSize =
+            sizeof( cacheMagic ) + 2 * sizeof( std::uint64_t );
+
+        std::uint64_t readU64( char const* data ) {
+            std::uint64_t value;
+            std::memcpy( &value, data, sizeof( value ) );
+            return value;
+        }
+
+        //! Does the run execute test cases whole, with all their checks?
+        bool runsWholeTestCases( IConfig const& config ) {
+            if ( !config.getSectionsToRun().empty() || !config.allowThrows() ) {
+                return false;
+            }
+            // Regressions are checked only for analysed benchmarks
+            const bool checksRegressions =
+                config.benchmarkRegressionThreshold() >= 0;
+            return !checksRegressions ||
+                   ( !config.skipBenchmarks() && !config.benchmarkNoAnalysis() );
+        }
+
+        void appendU64( std::string& out, std::uint64_t value ) {
+            char bytes[sizeof( value )];
+            std::memcpy( bytes, &value, sizeof( value ) );
+            out.append( bytes, sizeof( bytes ) );
+        }
+
+        std::uint64_t fnv1a( std::uint64_t hash, StringRef data ) {
+            for ( const char c : data ) {
+                hash ^= static_cast<unsigned char>( c );
+                hash *= 1099511628211u;
+            }
+            return hash;
+        }
+    } // end unnamed namespace
+
+    std::uint64_t computeBuildFingerprint( std::string const& cacheKey,
+                                           std::string const& processName ) {
+        const std::uint64_t basis = 14695981039346656037u;
+        if ( !cacheKey.empty() ) {
+            return fnv1a( basis, cacheKey );
+        }
+#if defined( CATCH_PLATFORM_LINUX )
+        static_cast<void>( processName );
+        Detail::MappedFile executable( "/proc/self/exe" );
+#else
+        Detail::MappedFile executable( processName );
+#endif
+        if ( executable.contents().empty() ) {
+            return 0;
+        }
+        return fnv1a( basis, executable.contents() );
+    }
+
+    TestResultCache::TestResultCache( std::string path,
+                                      std::uint64_t buildFingerprint ):
+        m_path( CATCH_MOVE( path ) ),
+        m_buildFingerprint( buildFingerprint ),
+        m_file( m_path ) {
+        auto contents = m_file.contents();
+        if ( contents.size() < cacheHeaderSize ||
+             std::memcmp( contents.data(), cacheMagic, sizeof( cacheMagic ) ) !=
+                 0 ||
+             readU64( contents.data() + sizeof( cacheMagic ) ) !=
+                 m_buildFingerprint ) {
+            return;
+        }
+        const auto entryCount =
+            readU64( contents.data() + sizeof( cacheMagic ) +
+                     sizeof( std::uint64_t ) );
+        const auto entriesSize = contents.size() - cacheHeaderSize;
+        if ( entriesSize % sizeof( std::uint64_t ) != 0 ||
+             entryCount != entriesSize / sizeof( std::uint64_t ) ) {
+            // Truncated or otherwise damaged cache, ignore it
+            return;
+        }
+        m_entries = contents.data() + cacheHeaderSize;
+        m_entryCount = static_cast<std::size_t>( entryCount );
+    }
+
+    bool TestResultCache::containsPass( std::uint64_t testHash ) const {
+        std::size_t first = 0;
+        std::size_t last = m_entryCount;
+        while ( first < last ) {
+            const auto middle = first + ( last - first ) / 2;
+            const auto entry =
+                readU64( m_entries + middle * sizeof( std::uint64_t ) );
+            if ( entry == testHash ) {
+                return true;
+            }
+            if ( entry < testHash ) {
+                first = middle + 1;
+            } else {
+                last = middle;
+            }
+        }
+        return false;
+    }
+
+    bool TestResultCache::hasPassed( TestCaseInfo const& testInfo ) const {
+        return containsPass( persistentTestCaseHash( testInfo ) );
+    }
+
+    void TestResultCache::recordResult( TestCaseInfo const& testInfo,
+                                        bool passed ) {
+        m_recordedResults[persistentTestCaseHash( testInfo )] = passed;
+    }
+
+    bool TestResultCache::save() const {
+        Detail::FileLock lock( m_path );
+        const TestResultCache cached( m_path, m_buildFingerprint );
+
+        std::vector<std::uint64_t> passes;
+        passes.reserve( cached.m_entryCount + m_recordedResults.size() );
+        for ( std::size_t i = 0; i < cached.m_entryCount; ++i ) {
+            const auto entry = readU64( cached.m_entries + i * sizeof( std::uint64_t ) );
+            auto recorded = m_recordedResults.find( entry );
+            if ( recorded == m_recordedResults.end() || recorded->second ) {
+                passes.push_back( entry );
+            }
+        }
+        for ( auto const& result : m_recordedResults ) {
+            if ( result.second ) {
+                passes.push_back( result.first );
+            }
+        }
+        std::sort( passes.begin(), passes.end() );
+        passes.erase( std::unique( passes.begin(), passes.end() ),
+                      passes.end() );
+
+        std::string out( cacheMagic, sizeof( cacheMagic ) );
+        out.reserve( cacheHeaderSize + passes.size() * sizeof( std::uint64_t ) );
+        appendU64( out, m_buildFingerprint );
+        appendU64( out, passes.size() );
+        for ( const auto pass : passes ) {
+            appendU64( out, pass );
+        }
+        return Detail::replaceFileAtomically( m_path, out );
+    }
+
+    TestResultCacheRecorder::TestResultCacheRecorder( IConfig const* config,
+                                                      TestResultCache& cache ):
+        EventListenerBase( config ),
+        m_cache( cache ),
+        m_recordPasses( runsWholeTestCases( *config ) ) {}
+
+    void TestResultCacheRecorder::testCaseEnded(
+        TestCaseStats const& testCaseStats ) {
+        // Only clean passes are cached. Skipped tests, and tests that
+        // failed but are allowed to, have to run again next time.
+        auto const& testCases = testCaseStats.totals.testCases;
+        const bool passed = testCases.passed > 0 && testCases.failed == 0 &&
+                            testCases.failedButOk == 0 &&
+                            testCases.skipped == 0;
+        if ( passed && !m_recordPasses ) {
+            return;
+        }
+        m_cache.recordResult( *testCaseStats.testInfo, passed );
+        m_recordedAny = true;
+    }
+
+    void TestResultCacheRecorder::testRunEnded( TestRunStats const& ) {
+        if ( m_recordedAny && !m_cache.save() ) {
+            Catch::cerr() << "Warning: could not write test result cache\n";
+        }
+    }
+
+} // end namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_TEST_RESULT_CACHE_CPP_INCLUDED
+// END Amalgamated content from catch_test_result_cache.cpp (@wolfram77)
@@ -0,0 +1,244 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_TEST_TIMINGS_HPP_INCLUDED
+#define CATCH_TEST_TIMINGS_HPP_INCLUDED
+
+#include "../reporters/catch_reporter_event_listener.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+
+namespace Catch {
+
+    struct TestCaseInfo;
+
+    /**
+     * Durations of test cases recorded by previous runs
+     *
+     * The timings are keyed by `persistentTestCaseHash`, and stored in
+     * a text file, one test case per line, as hash, duration in seconds
+     * and the name of the test case (for humans only).
+     */
+    class TestTimings {
+    public:
+        TestTimings() = default;
+        //! Loads timings from the file, missing file means no timings
+        explicit TestTimings( std::string const& path );
+
+        /**
+         * Returns expected duration of the test case in seconds
+         *
+         * Test cases without recorded duration are expected to take
+         * the median of the recorded durations (or 1s if there are none).
+         */
+        double estimate( TestCaseInfo const& testInfo ) const;
+        void record( TestCaseInfo const& testInfo, double seconds );
+
+        /**
+         * Writes the recorded timings into the file, merged with the
+         * timings it has by then, e.g. from other shards
+         *
+         * Returns false if the timings could not be written.
+         */
+        bool save( std::string const& path ) const;
+
+    private:
+        struct Timing {
+            double seconds;
+            std::string name;
+        };
+        std::map<std::uint64_t, Timing> m_timings;
+        std::set<std::uint64_t> m_recorded;
+        double m_defaultEstimate = 1.;
+    };
+
+    /**
+     * Returns the file recorded timings are saved to, empty if none
+     *
+     * That is `IConfig::testTimingsOutputFile`, or the timings file
+     * itself, except for balanced shards. Every shard has to split the
+     * tests by the same timings, so they must not change the file while
+     * other shards may still be about to read it.
+     */
+    std::string testTimingsOutputPath( IConfig const& config );
+
+    /**
+     * Records durations of the executed test cases into the timings
+     * file given by `testTimingsOutputPath`
+     *
+     * Durations of test cases that were not executed in this run are
+     * kept, so that the timings of all shards can share one file.
+     */
+    class TestTimingsRecorder final : public EventListenerBase {
+    public:
+        TestTimingsRecorder( IConfig const* config );
+
+        void testCaseStarting( TestCaseInfo const& testInfo ) override;
+        void sectionStarting( SectionInfo const& sectionInfo ) override;
+        void sectionEnded( SectionStats const& sectionStats ) override;
+        void testCaseEnded( TestCaseStats const& testCaseStats ) override;
+        void testRunEnded( TestRunStats const& testRunStats ) override;
+
+    private:
+        std::string m_outputPath;
+        TestTimings m_timings;
+        double m_testCaseDuration = 0.;
+        std::size_t m_sectionDepth = 0;
+        bool m_recordedAny = false;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_TEST_TIMINGS_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_test_timings.cpp (@wolfram77)
+#ifndef CATCH_TEST_TIMINGS_CPP_INCLUDED
+#define CATCH_TEST_TIMINGS_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_test_timings.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_persistent_file.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_test_case_info_hasher.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace Catch {
+
+    TestTimings::TestTimings( std::string const& path ) {
+        std::string contents;
+        if ( path.empty() || !Detail::readWholeFile( path, contents ) ) {
+            return;
+        }
+
+        std::istringstream in( contents );
+        std::string line;
+        while ( std::getline( in, line ) ) {
+            std::istringstream lineStream( line );
+            std::uint64_t hash;
+            double seconds;
+            if ( !( lineStream >> std::hex >> hash >> std::dec >> seconds ) ||
+                 seconds < 0 ) {
+                // Silently skip malformed lines, the file is only a hint
+                continue;
+            }
+            std::string name;
+            std::getline( lineStream >> std::ws, name );
+            m_timings[hash] = { seconds, CATCH_MOVE( name ) };
+        }
+
+        if ( !m_timings.empty() ) {
+            std::vector<double> durations;
+            durations.reserve( m_timings.size() );
+            for ( auto const& timing : m_timings ) {
+                durations.push_back( timing.second.seconds );
+            }
+            auto median = durations.begin() + static_cast<std::ptrdiff_t>(
+                                                  durations.size() / 2 );
+            std::nth_element( durations.begin(), median, durations.end() );
+            m_defaultEstimate = *median;
+        }
+    }
+
+    double TestTimings::estimate( TestCaseInfo const& testInfo ) const {
+        // Tests too fast to measure still have to be spread across shards,
+        // so no estimate is allowed to be zero.
+        constexpr double minimalEstimate = 1e-6;
+        auto it = m_timings.find( persistentTestCaseHash( testInfo ) );
+        const double seconds =
+            it != m_timings.end() ? it->second.seconds : m_defaultEstimate;
+        return ( std::max )( seconds, minimalEstimate );
+    }
+
+    void TestTimings::record( TestCaseInfo const& testInfo, double seconds ) {
+        const auto hash = persistentTestCaseHash( testInfo );
+        m_timings[hash] = { seconds, testInfo.name };
+        m_recorded.insert( hash );
+    }
+
+    bool TestTimings::save( std::string const& path ) const {
+        Detail::FileLock lock( path );
+        TestTimings merged( path );
+        for ( const auto hash : m_recorded ) {
+            merged.m_timings[hash] = m_timings.at( hash );
+        }
+
+        std::ostringstream out;
+        out << std::setprecision( 6 ) << std::fixed;
+        for ( auto const& timing : merged.m_timings ) {
+            out << std::hex << std::setw( 16 ) << std::setfill( '0' )
+                << timing.first << std::dec << ' ' << timing.second.seconds
+                << ' ' << timing.second.name << '\n';
+        }
+        return Detail::replaceFileAtomically( path, out.str() );
+    }
+
+    std::string testTimingsOutputPath( IConfig const& config ) {
+        if ( !config.testTimingsOutputFile().empty() ) {
+            return config.testTimingsOutputFile();
+        }
+        if ( config.shardStrategy() == ShardStrategy::Balanced &&
+             config.shardCount() > 1 ) {
+            return {};
+        }
+        return config.testTimingsFile();
+    }
+
+    // Saving merges the recorded timings into the file, so the timings
+    // it has now need not be loaded
+    TestTimingsRecorder::TestTimingsRecorder( IConfig const* config ):
+        EventListenerBase( config ),
+        m_outputPath( testTimingsOutputPath( *config ) ) {}
+
+    void TestTimingsRecorder::testCaseStarting( TestCaseInfo const& ) {
+        m_testCaseDuration = 0.;
+        m_sectionDepth = 0;
+    }
+
+    void TestTimingsRecorder::sectionStarting( SectionInfo const& ) {
+        ++m_sectionDepth;
+    }
+
+    void TestTimingsRecorder::sectionEnded( SectionStats const& sectionStats ) {
+        // Every run of a test case (one per leaf section) has its own
+        // root section, whose duration covers the whole run.
+        if ( --m_sectionDepth == 0 ) {
+            m_testCaseDuration += sectionStats.durationInSeconds;
+        }
+    }
+
+    void TestTimingsRecorder::testCaseEnded( TestCaseStats const& testCaseStats ) {
+        m_timings.record( *testCaseStats.testInfo, m_testCaseDuration );
+        m_recordedAny = true;
+    }
+
+    void TestTimingsRecorder::testRunEnded( TestRunStats const& ) {
+        if ( m_recordedAny && !m_timings.save( m_outputPath ) ) {
+            Catch::cerr() << "Warning: could not write test timings to '"
+                          << m_outputPath << "'\n";
+        }
+    }
+
+} // end namespace Catch
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_TEST_TIMINGS_CPP_INCLUDED
+// END Amalgamated content from catch_test_timings.cpp (@wolfram77)
@@ -0,0 +1,160 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_TEST_WATCHDOG_HPP_INCLUDED
+#define CATCH_TEST_WATCHDOG_HPP_INCLUDED
+
+#include "catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <cstdint>
+
+namespace Catch {
+
+    class ITestTimeoutHandler {
+    public:
+        virtual ~ITestTimeoutHandler(); // = default
+        //! Called from the watchdog thread when the watched test times out
+        //!
+        //! The test may have been disarmed, or another one armed, by the
+        //! time the call is made, compare `armId` with the id from `arm`.
+        virtual void handleTestTimeout( std::uint64_t armId ) = 0;
+    };
+
+} // end namespace Catch
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+
+#include "catch_noncopyable.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Catch {
+
+    /**
+     * Watches for test cases that run for too long
+     *
+     * The watchdog thread is started when the watchdog is first armed,
+     * and it sleeps until the deadline of the armed timeout. If the
+     * watchdog is not disarmed before the deadline, the handler is
+     * called from the watchdog thread, while the test keeps running.
+     */
+    class TestWatchdog : Detail::NonCopyable {
+    public:
+        TestWatchdog() = default;
+        ~TestWatchdog();
+
+        //! Returns an id of the arm, unique for the watchdog
+        std::uint64_t arm( std::chrono::milliseconds timeout,
+                           ITestTimeoutHandler& handler );
+        void disarm();
+
+    private:
+        void watch();
+
+        std::mutex m_mutex;
+        std::condition_variable m_changed;
+        std::thread m_thread;
+        std::chrono::steady_clock::time_point m_deadline;
+        ITestTimeoutHandler* m_handler = nullptr;
+        std::uint64_t m_armId = 0;
+        bool m_stopping = false;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_USE_ASYNC
+
+#endif // CATCH_TEST_WATCHDOG_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_test_watchdog.cpp (@wolfram77)
+#ifndef CATCH_TEST_WATCHDOG_CPP_INCLUDED
+#define CATCH_TEST_WATCHDOG_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_test_watchdog.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+
+namespace Catch {
+    ITestTimeoutHandler::~ITestTimeoutHandler() = default;
+} // end namespace Catch
+
+#if defined( CATCH_CONFIG_USE_ASYNC )
+
+namespace Catch {
+
+    TestWatchdog::~TestWatchdog() {
+        if ( m_thread.joinable() ) {
+            {
+                std::lock_guard<std::mutex> lock( m_mutex );
+                m_stopping = true;
+            }
+            m_changed.notify_one();
+            m_thread.join();
+        }
+    }
+
+    std::uint64_t TestWatchdog::arm( std::chrono::milliseconds timeout,
+                                     ITestTimeoutHandler& handler ) {
+        std::uint64_t armId;
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_deadline = std::chrono::steady_clock::now() + timeout;
+            m_handler = &handler;
+            armId = ++m_armId;
+        }
+        if ( !m_thread.joinable() ) {
+            m_thread = std::thread( [this] { watch(); } );
+        } else {
+            m_changed.notify_one();
+        }
+        return armId;
+    }
+
+    void TestWatchdog::disarm() {
+        {
+            std::lock_guard<std::mutex> lock( m_mutex );
+            m_handler = nullptr;
+        }
+        m_changed.notify_one();
+    }
+
+    void TestWatchdog::watch() {
+        std::unique_lock<std::mutex> lock( m_mutex );
+        while ( !m_stopping ) {
+            if ( !m_handler ) {
+                m_changed.wait( lock );
+                continue;
+            }
+            if ( m_changed.wait_until( lock, m_deadline ) ==
+                     std::cv_status::timeout &&
+                 m_handler &&
+                 std::chrono::steady_clock::now() >= m_deadline ) {
+                auto* handler = m_handler;
+                const auto armId = m_armId;
+                m_handler = nullptr;
+                lock.unlock();
+                handler->handleTestTimeout( armId );
+                lock.lock();
+            }
+        }
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_USE_ASYNC
+
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_TEST_WATCHDOG_CPP_INCLUDED
+// END Amalgamated content from catch_test_watchdog.cpp (@wolfram77)
@@ -0,0 +1,430 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_WORKER_PROCESSES_HPP_INCLUDED
+#define CATCH_WORKER_PROCESSES_HPP_INCLUDED
+
+#include "catch_compiler_capabilities.hpp"  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_FORK )
+
+#include "catch_event_recorder.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_totals.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <vector>
+
+namespace Catch {
+
+    class IConfig;
+    class IEventListener;
+    class TestCaseHandle;
+
+    /**
+     * Runs test cases in forked worker processes
+     *
+     * Workers are long-lived, and they take the index of the next test case
+     * to run from a counter shared by all of them, so that no worker idles
+     * while there are tests left. Events from the workers are sent back over
+     * pipes, and replayed into the reporter one whole test case at a time.
+     *
+     * If a worker dies, only the test case it was running fails, and a new
+     * worker is started in its place if there are tests left.
+     */
+    class WorkerProcessPool {
+    public:
+        WorkerProcessPool( IConfig const* config, IEventListener& reporter );
+
+        //! Runs the tests in `workerCount` processes, returns their totals
+        Totals runTests( std::vector<TestCaseHandle const*> const& tests,
+                         unsigned int workerCount );
+
+    private:
+        IConfig const* m_config;
+        IEventListener& m_reporter;
+        // The replayer owns strings referenced by the replayed events,
+        // so it has to live until the end of the test run
+        Detail::EventReplayer m_replayer;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_FORK
+
+#endif // CATCH_WORKER_PROCESSES_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_worker_processes.cpp (@wolfram77)
+#ifndef CATCH_WORKER_PROCESSES_CPP_INCLUDED
+#define CATCH_WORKER_PROCESSES_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_worker_processes.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_FORK )
+
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_reporter.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_enforce.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_run_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_stdstreams.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_reusable_string_stream.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <ostream>
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace Catch {
+
+    namespace {
+
+        // Lives in memory shared between the parent and all workers
+        struct SharedWorkQueue {
+            std::atomic<std::uint64_t> nextTest{ 0 };
+            std::atomic<bool> aborting{ false };
+        };
+
+        class SharedWorkQueueMapping {
+            void* m_memory;
+
+        public:
+            SharedWorkQueueMapping():
+                m_memory( mmap( nullptr,
+                                sizeof( SharedWorkQueue ),
+                                PROT_READ | PROT_WRITE,
+                                MAP_SHARED | MAP_ANONYMOUS,
+                                -1,
+                                0 ) ) {
+                if ( m_memory == MAP_FAILED ) {
+                    CATCH_RUNTIME_ERROR(
+                        "Could not map memory shared with worker processes: "
+                        << std::strerror( errno ) );
+                }
+                new ( m_memory ) SharedWorkQueue();
+            }
+            SharedWorkQueueMapping( SharedWorkQueueMapping const& ) = delete;
+            SharedWorkQueueMapping& operator=( SharedWorkQueueMapping const& ) = delete;
+            ~SharedWorkQueueMapping() {
+                get().~SharedWorkQueue();
+                munmap( m_memory, sizeof( SharedWorkQueue ) );
+            }
+
+            SharedWorkQueue& get() {
+                return *static_cast<SharedWorkQueue*>( m_memory );
+            }
+        };
+
+        void writeAll( int fd, std::string const& data ) {
+            std::size_t written = 0;
+            while ( written < data.size() ) {
+                auto ret = write( fd, data.data() + written, data.size() - written );
+                if ( ret < 0 ) {
+                    if ( errno == EINTR ) { continue; }
+                    // The parent is gone, there is nobody to report to
+                    _exit( 1 );
+                }
+                written += static_cast<std::size_t>( ret );
+            }
+        }
+
+        class PipeEventSink final : public Detail::IRecordedEventSink {
+            int m_fd;
+
+        public:
+            explicit PipeEventSink( int fd ): m_fd( fd ) {}
+
+            void eventsRecorded( std::string& events ) override {
+                writeAll( m_fd, events );
+                events.clear();
+            }
+        };
+
+        // Only set in worker processes, while they run tests
+        Detail::EventRecorder* workerRecorder = nullptr;
+        int workerFd = -1;
+
+        //! Ends a worker whose test called `exit`, before the static
+        //! destructors of the parent process run in it
+        void endExitingWorker( int status ) {
+            if ( workerRecorder ) {
+                // Passed assertions are not sent until something else is
+                writeAll( workerFd, workerRecorder->takeEvents() );
+            }
+            Catch::cout().flush();
+            Catch::cerr().flush();
+            std::fflush( nullptr );
+            _exit( status );
+        }
+
+#if defined( __GLIBC__ )
+        void onWorkerExit( int status, void* ) { endExitingWorker( status ); }
+#else
+        // Without `on_exit` the status is unknown, but it has to be
+        // reported as an exit, rather than the crash it could become
+        void onWorkerExit() { endExitingWorker( EXIT_FAILURE ); }
+#endif
+
+        // Body of the worker process, never returns
+        [[noreturn]] void
+        runWorker( IConfig const* config,
+                   ReporterPreferences const& preferences,
+                   std::vector<TestCaseHandle const*> const& tests,
+                   SharedWorkQueue& queue,
+                   int fd ) {
+            {
+                PipeEventSink sink( fd );
+                auto recorder = Detail::make_unique<Detail::EventRecorder>(
+                    config, preferences, &sink );
+                workerRecorder = recorder.get();
+                workerFd = fd;
+#if defined( __GLIBC__ )
+                on_exit( onWorkerExit, nullptr );
+#else
+                std::atexit( onWorkerExit );
+#endif
+                RunContext context( config, CATCH_MOVE( recorder ) );
+                while ( !queue.aborting.load() ) {
+                    const auto index = queue.nextTest.fetch_add( 1 );
+                    if ( index >= tests.size() ) {
+                        break;
+                    }
+                    std::string claim;
+                    Detail::appendMarkerFrame( claim, index );
+                    writeAll( fd, claim );
+
+                    context.runTest( *tests[static_cast<std::size_t>( index )] );
+                    if ( context.aborting() ) {
+                        queue.aborting = true;
+                    }
+                }
+                workerRecorder = nullptr;
+            }
+            Catch::cout().flush();
+            Catch::cerr().flush();
+            std::fflush( nullptr );
+            close( fd );
+            // We do not want to run any atexit handlers or static destructors
+            // of the parent process, or flush its buffers a second time.
+            _exit( 0 );
+        }
+
+        struct Worker {
+            pid_t pid = -1;
+            int fd = -1;
+            //! Events received from the worker that are not processed yet
+            std::string incoming;
+            //! Events of the test case currently running in the worker
+            std::string testCaseEvents;
+            std::size_t testIndex = 0;
+            bool hasTest = false;
+        };
+
+        std::string describeWorkerExit( int status ) {
+            ReusableStringStream rss;
+            if ( WIFSIGNALED( status ) ) {
+                const int sig = WTERMSIG( status );
+                rss << "Worker process was terminated by signal " << sig;
+                if ( char const* name = strsignal( sig ) ) {
+                    rss << " (" << name << ')';
+                }
+            } else if ( WIFEXITED( status ) ) {
+                rss << "Worker process exited with code "
+                    << WEXITSTATUS( status ) << " while running the test";
+            } else {
+                rss << "Worker process ended unexpectedly";
+            }
+            return rss.str();
+        }
+
+    } // end unnamed namespace
+
+    WorkerProcessPool::WorkerProcessPool( IConfig const* config,
+                                          IEventListener& reporter ):
+        m_config( config ), m_reporter( reporter ), m_replayer( reporter ) {}
+
+    Totals
+    WorkerProcessPool::runTests( std::vector<TestCaseHandle const*> const& tests,
+                                 unsigned int workerCount ) {
+        SharedWorkQueueMapping mapping;
+        SharedWorkQueue& queue = mapping.get();
+        const auto abortAfter =
+            m_config->abortAfter() > 0
+                ? static_cast<std::uint64_t>( m_config->abortAfter() )
+                : (std::numeric_limits<std::uint64_t>::max)();
+
+        Totals totals;
+        std::vector<bool> finished( tests.size(), false );
+        std::vector<Worker> workers;
+
+        auto startWorker = [&]( Worker& worker ) {
+            int fds[2];
+            if ( pipe( fds ) != 0 ) {
+                CATCH_RUNTIME_ERROR( "Could not create pipe for worker process: "
+                                     << std::strerror( errno ) );
+            }
+            // Anything buffered now would be written out twice otherwise
+            Catch::cout().flush();
+            Catch::cerr().flush();
+            Catch::clog().flush();
+            std::fflush( nullptr );
+
+            const pid_t pid = fork();
+            if ( pid < 0 ) {
+                CATCH_RUNTIME_ERROR( "Could not start worker process: "
+                                     << std::strerror( errno ) );
+            }
+            if ( pid == 0 ) {
+                close( fds[0] );
+                for ( auto const& other : workers ) {
+                    if ( other.fd >= 0 ) { close( other.fd ); }
+                }
+                runWorker( m_config, m_reporter.getPreferences(), tests, queue, fds[1] );
+            }
+            close( fds[1] );
+            worker = Worker();
+            worker.pid = pid;
+            worker.fd = fds[0];
+        };
+
+        auto finishTest = [&]( Worker& worker, StringRef abortMessage ) {
+            totals += m_replayer.replayTestCase(
+                tests[worker.testIndex]->getTestCaseInfo(),
+                worker.testCaseEvents,
+                abortMessage );
+            finished[worker.testIndex] = true;
+            worker.hasTest = false;
+            worker.testCaseEvents.clear();
+            if ( totals.assertions.failed >= abortAfter ) {
+                queue.aborting = true;
+            }
+        };
+
+        auto processEvents = [&]( Worker& worker ) {
+            std::size_t pos = 0;
+            std::size_t frameStart = 0;
+            Detail::RecordedFrame frame;
+            while ( Detail::nextRecordedFrame( worker.incoming, pos, frame ) ) {
+                if ( frame.kind == Detail::RecordedEvent::Marker ) {
+                    worker.testIndex = static_cast<std::size_t>(
+                        Detail::readMarkerFrame( frame.payload ) );
+                    worker.hasTest = true;
+                } else {
+                    worker.testCaseEvents.append( worker.incoming, frameStart, pos - frameStart );
+                    if ( frame.kind == Detail::RecordedEvent::TestCaseEnded ) {
+                        finishTest( worker, StringRef() );
+                    }
+                }
+                frameStart = pos;
+            }
+            worker.incoming.erase( 0, pos );
+        };
+
+        const auto workersToStart = (std::min)(
+            static_cast<std::size_t>( workerCount ), tests.size() );
+        workers.resize( workersToStart );
+        for ( auto& worker : workers ) {
+            startWorker( worker );
+        }
+
+        std::vector<pollfd> pollFds;
+        std::vector<std::size_t> polledWorkers;
+        char buffer[64 * 1024];
+        for ( ;; ) {
+            pollFds.clear();
+            polledWorkers.clear();
+            for ( std::size_t i = 0; i < workers.size(); ++i ) {
+                if ( workers[i].fd >= 0 ) {
+                    pollFds.push_back( pollfd{ workers[i].fd, POLLIN, 0 } );
+                    polledWorkers.push_back( i );
+                }
+            }
+            if ( pollFds.empty() ) {
+                break;
+            }
+
+            if ( poll( pollFds.data(), static_cast<nfds_t>( pollFds.size() ), -1 ) < 0 ) {
+                if ( errno == EINTR ) { continue; }
+                CATCH_RUNTIME_ERROR( "Could not wait for worker processes: "
+                                     << std::strerror( errno ) );
+            }
+
+            for ( std::size_t i = 0; i < pollFds.size(); ++i ) {
+                if ( pollFds[i].revents == 0 ) {
+                    continue;
+                }
+                auto& worker = workers[polledWorkers[i]];
+                const auto received = read( worker.fd, buffer, sizeof( buffer ) );
+                if ( received < 0 && errno == EINTR ) {
+                    continue;
+                }
+                if ( received > 0 ) {
+                    worker.incoming.append( buffer, static_cast<std::size_t>( received ) );
+                    processEvents( worker );
+                    continue;
+                }
+
+                // The worker is gone, either because it ran out of tests,
+                // or because it died.
+                close( worker.fd );
+                worker.fd = -1;
+                int status = 0;
+                while ( waitpid( worker.pid, &status, 0 ) < 0 && errno == EINTR ) {}
+                if ( worker.hasTest ) {
+                    finishTest( worker, describeWorkerExit( status ) );
+                }
+                if ( !queue.aborting.load() && queue.nextTest.load() < tests.size() ) {
+                    startWorker( worker );
+                }
+            }
+        }
+
+        // Tests that were claimed by a worker that died before it could
+        // report anything still have to fail, and tests that were never
+        // claimed because the run is aborting are reported as skipped.
+        const auto claimedTests = (std::min)(
+            static_cast<std::size_t>( queue.nextTest.load() ), tests.size() );
+        for ( std::size_t i = 0; i < tests.size(); ++i ) {
+            if ( finished[i] ) {
+                continue;
+            }
+            if ( i < claimedTests ) {
+                totals += m_replayer.replayTestCase(
+                    tests[i]->getTestCaseInfo(),
+                    StringRef(),
+                    "Worker process died before the test started"_sr );
+            } else {
+                m_reporter.skipTest( tests[i]->getTestCaseInfo() );
+            }
+        }
+
+        return totals;
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_FORK
+
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_WORKER_PROCESSES_CPP_INCLUDED
+// END Amalgamated content from catch_worker_processes.cpp (@wolfram77)
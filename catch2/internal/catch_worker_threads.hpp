@@ -0,0 +1,221 @@
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+#ifndef CATCH_WORKER_THREADS_HPP_INCLUDED
+#define CATCH_WORKER_THREADS_HPP_INCLUDED
+
+#include "../catch_user_config.hpp"  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+
+#include "catch_event_recorder.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_totals.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <vector>
+
+namespace Catch {
+
+    class IConfig;
+    class IEventListener;
+    class TestCaseHandle;
+
+    /**
+     * Runs test cases concurrently in a pool of threads
+     *
+     * Every thread has its own RunContext, and records the events of the
+     * test cases it runs. The events are replayed into the reporter from
+     * the calling thread, one whole test case at a time and in the order
+     * of the given tests, so the reporter output does not depend on the
+     * scheduling of the threads.
+     *
+     * Unlike `WorkerProcessPool`, a fatal error in a test case ends
+     * the whole process, and output of the tests is not captured.
+     */
+    class WorkerThreadPool {
+    public:
+        WorkerThreadPool( IConfig const* config, IEventListener& reporter );
+
+        //! Runs the tests in `threadCount` threads, returns their totals
+        Totals runTests( std::vector<TestCaseHandle const*> const& tests,
+                         unsigned int threadCount );
+
+    private:
+        IConfig const* m_config;
+        IEventListener& m_reporter;
+        // The replayer owns strings referenced by the replayed events,
+        // so it has to live until the end of the test run
+        Detail::EventReplayer m_replayer;
+    };
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_THREAD_SAFE_ASSERTIONS
+
+#endif // CATCH_WORKER_THREADS_HPP_INCLUDED
+
+
+
+// BEGIN Amalgamated content from catch_worker_threads.cpp (@wolfram77)
+#ifndef CATCH_WORKER_THREADS_CPP_INCLUDED
+#define CATCH_WORKER_THREADS_CPP_INCLUDED
+#ifdef CATCH2_IMPLEMENTATION
+//              Copyright Catch2 Authors
+// Distributed under the Boost Software License, Version 1.0.
+//   (See accompanying file LICENSE.txt or copy at
+//        https://www.boost.org/LICENSE_1_0.txt)
+
+// SPDX-License-Identifier: BSL-1.0
+// #include "catch_worker_threads.hpp" // Disable self-include (@wolfram77)  // Adjust to relative path (@wolfram77)
+
+#if defined( CATCH_CONFIG_THREAD_SAFE_ASSERTIONS )
+
+#include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
+#include "../interfaces/catch_interfaces_reporter.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "catch_run_context.hpp"  // Adjust to relative path (@wolfram77)
+#include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace Catch {
+
+    WorkerThreadPool::WorkerThreadPool( IConfig const* config,
+                                        IEventListener& reporter ):
+        m_config( config ), m_reporter( reporter ), m_replayer( reporter ) {}
+
+    Totals
+    WorkerThreadPool::runTests( std::vector<TestCaseHandle const*> const& tests,
+                                unsigned int threadCount ) {
+        const auto abortAfter =
+            m_config->abortAfter() > 0
+                ? static_cast<std::uint64_t>( m_config->abortAfter() )
+                : (std::numeric_limits<std::uint64_t>::max)();
+
+        // Output redirection swaps process-wide stream buffers, so
+        // the threads cannot use it.
+        ReporterPreferences preferences = m_reporter.getPreferences();
+        preferences.shouldRedirectStdOut = false;
+
+        const auto workerCount = (std::min)(
+            static_cast<std::size_t>( threadCount ), tests.size() );
+
+        // The contexts are created up front from this thread, because
+        // creating them also registers them as the global result capture.
+        // It stays unset while the threads run, so that threads started by
+        // the tests fail clearly, rather than assert into the idle global
+        // context, see `ThreadResultCaptureScope`.
+        IResultCapture* const previousCapture =
+            getCurrentContext().getResultCapture();
+        std::vector<Detail::EventRecorder*> recorders;
+        std::vector<Detail::unique_ptr<RunContext>> contexts;
+        for ( std::size_t i = 0; i < workerCount; ++i ) {
+            auto recorder = Detail::make_unique<Detail::EventRecorder>(
+                m_config, preferences, nullptr );
+            recorders.push_back( recorder.get() );
+            contexts.push_back( Detail::make_unique<RunContext>(
+                m_config, CATCH_MOVE( recorder ) ) );
+            contexts.back()->disableFatalConditionHandling();
+        }
+        getCurrentMutableContext().setResultCapture( nullptr );
+
+        std::mutex mutex;
+        std::condition_variable testFinished;
+        std::vector<std::string> events( tests.size() );
+        std::vector<bool> finished( tests.size(), false );
+        std::size_t stoppedWorkers = 0;
+        std::exception_ptr workerException;
+        std::atomic<std::size_t> nextTest{ 0 };
+        std::atomic<bool> aborting{ false };
+
+        auto runWorker = [&]( std::size_t workerIndex ) {
+            RunContext& context = *contexts[workerIndex];
+            Context::setThreadResultCapture( &context );
+            CATCH_TRY {
+                while ( !aborting.load() ) {
+                    const auto index = nextTest.fetch_add( 1 );
+                    if ( index >= tests.size() ) {
+                        break;
+                    }
+                    context.runTest( *tests[index] );
+                    if ( context.aborting() ) {
+                        aborting = true;
+                    }
+                    auto testEvents = recorders[workerIndex]->takeEvents();
+                    std::lock_guard<std::mutex> lock( mutex );
+                    events[index] = CATCH_MOVE( testEvents );
+                    finished[index] = true;
+                    testFinished.notify_one();
+                }
+            } CATCH_CATCH_ALL {
+                std::lock_guard<std::mutex> lock( mutex );
+                if ( !workerException ) {
+                    workerException = std::current_exception();
+                }
+                aborting = true;
+            }
+            Context::setThreadResultCapture( nullptr );
+            std::lock_guard<std::mutex> lock( mutex );
+            ++stoppedWorkers;
+            testFinished.notify_one();
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve( workerCount );
+        for ( std::size_t i = 0; i < workerCount; ++i ) {
+            threads.emplace_back( runWorker, i );
+        }
+
+        // Replaying in the order of the tests keeps the reporter output
+        // deterministic. Test cases that were never started because the
+        // run is aborting are reported as skipped.
+        Totals totals;
+        for ( std::size_t i = 0; i < tests.size(); ++i ) {
+            std::string testEvents;
+            {
+                std::unique_lock<std::mutex> lock( mutex );
+                testFinished.wait( lock, [&] {
+                    return finished[i] || stoppedWorkers == workerCount;
+                } );
+                if ( !finished[i] ) {
+                    lock.unlock();
+                    m_reporter.skipTest( tests[i]->getTestCaseInfo() );
+                    continue;
+                }
+                testEvents.swap( events[i] );
+            }
+            totals += m_replayer.replayTestCase(
+                tests[i]->getTestCaseInfo(),
+                testEvents,
+                "Test case did not finish"_sr );
+            if ( totals.assertions.failed >= abortAfter ) {
+                aborting = true;
+            }
+        }
+
+        for ( auto& thread : threads ) {
+            thread.join();
+        }
+        getCurrentMutableContext().setResultCapture( previousCapture );
+        if ( workerException ) {
+            std::rethrow_exception( workerException );
+        }
+
+        return totals;
+    }
+
+} // end namespace Catch
+
+#endif // CATCH_CONFIG_THREAD_SAFE_ASSERTIONS
+
+#endif // CATCH2_IMPLEMENTATION
+#endif // CATCH_WORKER_THREADS_CPP_INCLUDED
+// END Amalgamated content from catch_worker_threads.cpp (@wolfram77)
@@ -32,6 +32,7 @@ namespace Catch {
 
         void testCaseEnded(TestCaseStats const& _testCaseStats) override;
         void skipTest(TestCaseInfo const& testInfo) override;
+        void testCaseCached(TestCaseInfo const& testInfo) override;
     };
 
 } // end namespace Catch
@@ -79,6 +80,10 @@ namespace Catch {
         m_stream << ":test-result: SKIP " << testInfo.name << '\n';
     }
 
+    void AutomakeReporter::testCaseCached(TestCaseInfo const& testInfo) {
+        m_stream << ":test-result: PASS " << testInfo.name << '\n';
+    }
+
 } // end namespace Catch
 #endif // CATCH2_IMPLEMENTATION
 #endif // CATCH_REPORTER_AUTOMAKE_CPP_INCLUDED
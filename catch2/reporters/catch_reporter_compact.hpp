@@ -32,8 +32,12 @@ namespace Catch {
 
         void sectionEnded(SectionStats const& _sectionStats) override;
 
+        void testCaseCached(TestCaseInfo const& testInfo) override;
+
         void testRunEnded(TestRunStats const& _testRunStats) override;
 
+    private:
+        std::uint64_t m_cachedTestCases = 0;
     };
 
 } // end namespace Catch
@@ -291,8 +295,16 @@ private:
             }
         }
 
+        void CompactReporter::testCaseCached( TestCaseInfo const& ) {
+            ++m_cachedTestCases;
+        }
+
         void CompactReporter::testRunEnded( TestRunStats const& _testRunStats ) {
             printTestRunTotals( m_stream, *m_colour, _testRunStats.totals );
+            if ( m_cachedTestCases > 0 ) {
+                m_stream << pluralise( m_cachedTestCases, "test case"_sr )
+                         << " passed previously with the same build and did not run";
+            }
             m_stream << "\n\n" << std::flush;
             StreamingReporterBase::testRunEnded( _testRunStats );
         }
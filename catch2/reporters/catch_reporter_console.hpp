@@ -36,6 +36,7 @@ namespace Catch {
         void benchmarkFailed( StringRef error ) override;
 
         void testCaseEnded(TestCaseStats const& _testCaseStats) override;
+        void testCaseCached(TestCaseInfo const& testInfo) override;
         void testRunEnded(TestRunStats const& _testRunStats) override;
         void testRunStarting(TestRunInfo const& _testRunInfo) override;
 
@@ -57,6 +58,7 @@ namespace Catch {
 
         bool m_headerPrinted = false;
         bool m_testRunInfoPrinted = false;
+        std::uint64_t m_cachedTestCases = 0;
     };
 
 } // end namespace Catch
@@ -90,8 +92,14 @@ namespace Catch {
 #include "catch_reporter_helpers.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_get_random_seed.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_tsc_clock.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
+#include <iomanip>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -449,6 +457,219 @@ public:
     }
 };
 
+namespace {
+    // One row per counter, with the per iteration value under the mean
+    void printBenchmarkCounters( TablePrinter& tablePrinter,
+                                 std::vector<BenchmarkCounter> const& counters ) {
+        for ( auto const& counter : counters ) {
+            ReusableStringStream value;
+            value << std::fixed << std::setprecision( 2 ) << counter.value;
+            tablePrinter << "  " << counter.name << ColumnBreak()
+                         << value.str() << ColumnBreak() << ColumnBreak()
+                         << ColumnBreak();
+        }
+    }
+
+    // Decimal prefixes, like storage throughput is usually given in
+    std::string formatRate( double perSecond, StringRef unit ) {
+        static constexpr char const* prefixes[] = { "", "k", "M", "G", "T" };
+        std::size_t prefix = 0;
+        while ( std::abs( perSecond ) >= 1000. && prefix + 1 < sizeof( prefixes ) / sizeof( prefixes[0] ) ) {
+            perSecond /= 1000.;
+            ++prefix;
+        }
+        ReusableStringStream rss;
+        rss << std::fixed << std::setprecision( 2 ) << perSecond << ' '
+            << prefixes[prefix];
+        // "GB/s", but "k items/s"
+        if ( prefix > 0 && unit.size() > 1 ) {
+            rss << ' ';
+        }
+        rss << unit << "/s";
+        return rss.str();
+    }
+
+    // Bytes and items per second side by side
+    void printThroughput( TablePrinter& tablePrinter,
+                          Optional<double> const& bytesPerSecond,
+                          Optional<double> const& itemsPerSecond ) {
+        if ( !bytesPerSecond && !itemsPerSecond ) {
+            return;
+        }
+        tablePrinter << "  throughput" << ColumnBreak();
+        if ( bytesPerSecond ) {
+            tablePrinter << formatRate( *bytesPerSecond, "B"_sr );
+        }
+        tablePrinter << ColumnBreak();
+        if ( itemsPerSecond ) {
+            tablePrinter << formatRate( *itemsPerSecond, "items"_sr );
+        }
+        tablePrinter << ColumnBreak() << ColumnBreak();
+    }
+
+    // One row per counter, the value under the mean and the mode next to it
+    void printUserCounters( TablePrinter& tablePrinter,
+                            std::vector<BenchmarkUserCounter> const& counters ) {
+        for ( auto const& counter : counters ) {
+            std::string value;
+            if ( counter.mode == Benchmark::CounterMode::Rate ) {
+                value = formatRate( counter.value, StringRef() );
+            } else {
+                ReusableStringStream rss;
+                rss << std::fixed << std::setprecision( 2 ) << counter.value;
+                value = rss.str();
+            }
+            tablePrinter << "  " << counter.name << ColumnBreak() << value
+                         << ColumnBreak()
+                         << ( counter.mode == Benchmark::CounterMode::Sum
+                                  ? "per iteration"_sr
+                                  : Benchmark::counterModeName( counter.mode ) )
+                         << ColumnBreak() << ColumnBreak();
+        }
+    }
+
+    // Estimates under the mean columns, the point only without analysis
+    void printPercentiles( TablePrinter& tablePrinter,
+                           std::vector<BenchmarkPercentile> const& percentiles,
+                           bool withBounds ) {
+        for ( auto const& percentile : percentiles ) {
+            ReusableStringStream name;
+            name << "  p" << percentile.percentile;
+            tablePrinter << name.str() << ColumnBreak()
+                         << Duration( percentile.value.point.count() )
+                         << ColumnBreak();
+            if ( withBounds ) {
+                tablePrinter << Duration( percentile.value.lower_bound.count() )
+                             << ColumnBreak()
+                             << Duration( percentile.value.upper_bound.count() );
+            } else {
+                tablePrinter << ColumnBreak();
+            }
+            tablePrinter << ColumnBreak();
+        }
+    }
+
+    // Slowest iteration and jitter under the mean, like the percentiles
+    void printIterationTimes( TablePrinter& tablePrinter,
+                              Optional<Benchmark::FDuration> const& maxIteration,
+                              Optional<Benchmark::FDuration> const& jitter ) {
+        if ( maxIteration ) {
+            tablePrinter << "  max" << ColumnBreak()
+                         << Duration( maxIteration->count() ) << ColumnBreak()
+                         << ColumnBreak() << ColumnBreak();
+        }
+        if ( jitter ) {
+            tablePrinter << "  jitter" << ColumnBreak()
+                         << Duration( jitter->count() ) << ColumnBreak()
+                         << ColumnBreak() << ColumnBreak();
+        }
+    }
+
+    // Shortest and longest latency around a density plot of the buckets,
+    // in as many logarithmically spaced bins as fit into a column
+    void printHistogram( TablePrinter& tablePrinter,
+                         std::vector<BenchmarkHistogramBucket> const& histogram ) {
+        if ( histogram.empty() ) {
+            return;
+        }
+        static constexpr char density[] = " .:-=+*#%@";
+        static constexpr std::size_t levels = sizeof( density ) - 2;
+        static constexpr std::size_t binCount = 12;
+
+        const double lowest = (std::max)( histogram.front().lowerBound, 1e-3 );
+        const double highest = (std::max)( histogram.back().upperBound, lowest );
+        const double logRange = std::log( highest / lowest );
+        std::uint64_t bins[binCount] = {};
+        for ( auto const& bucket : histogram ) {
+            const double middle =
+                (std::max)( ( bucket.lowerBound + bucket.upperBound ) / 2., lowest );
+            std::size_t bin = 0;
+            if ( logRange > 0. ) {
+                bin = static_cast<std::size_t>(
+                    std::log( middle / lowest ) / logRange * binCount );
+            }
+            bins[(std::min)( bin, binCount - 1 )] += bucket.count;
+        }
+        const auto fullest = *std::max_element( bins, bins + binCount );
+
+        std::string plot( binCount, ' ' );
+        for ( std::size_t i = 0; i < binCount; ++i ) {
+            if ( bins[i] > 0 ) {
+                // Any bin with latencies in it is visible
+                plot[i] = density[1 + ( bins[i] * levels - 1 ) / fullest];
+            }
+        }
+        tablePrinter << "  histogram" << ColumnBreak()
+                     << Duration( histogram.front().lowerBound ) << ColumnBreak()
+                     << plot << ColumnBreak()
+                     << Duration( histogram.back().upperBound ) << ColumnBreak();
+    }
+
+    std::string formatChange( double ratio ) {
+        ReusableStringStream rss;
+        rss << std::showpos << std::fixed << std::setprecision( 2 )
+            << ( ratio - 1. ) * 100. << " %";
+        return rss.str();
+    }
+
+    // Change of the mean against the compared baseline, positive is slower
+    void printBaselineComparison( TablePrinter& tablePrinter,
+                                  Optional<Benchmark::Estimate<double>> const& ratio ) {
+        if ( !ratio ) {
+            return;
+        }
+        tablePrinter << "  vs baseline" << ColumnBreak()
+                     << formatChange( ratio->point ) << ColumnBreak()
+                     << formatChange( ratio->lower_bound ) << ColumnBreak()
+                     << formatChange( ratio->upper_bound ) << ColumnBreak();
+    }
+
+    void printColdCache( TablePrinter& tablePrinter, bool coldCache ) {
+        if ( coldCache ) {
+            tablePrinter << "  (cold cache)" << ColumnBreak() << ColumnBreak()
+                         << ColumnBreak() << ColumnBreak();
+        }
+    }
+
+    // Only drift big enough to make the samples retaken is shown
+    void printFrequencyDrift( TablePrinter& tablePrinter,
+                              Optional<double> const& drift ) {
+        if ( !drift ||
+             std::abs( *drift ) <= Benchmark::Detail::maximumFrequencyDrift ) {
+            return;
+        }
+        tablePrinter << "  cpu frequency drift" << ColumnBreak()
+                     << formatChange( 1. + *drift ) << ColumnBreak()
+                     << ColumnBreak() << ColumnBreak();
+    }
+
+    void printScalingEfficiency( TablePrinter& tablePrinter,
+                                 Optional<double> const& efficiency ) {
+        if ( !efficiency ) {
+            return;
+        }
+        ReusableStringStream rss;
+        rss << std::fixed << std::setprecision( 1 ) << *efficiency * 100.
+            << " %";
+        tablePrinter << "  scaling efficiency" << ColumnBreak() << rss.str()
+                     << ColumnBreak() << ColumnBreak() << ColumnBreak();
+    }
+
+    void printComplexity( TablePrinter& tablePrinter,
+                          Optional<Benchmark::ComplexityFit> const& fit ) {
+        if ( !fit ) {
+            return;
+        }
+        ReusableStringStream rss;
+        rss << "rms " << std::fixed << std::setprecision( 1 )
+            << fit->rms * 100. << " %";
+        tablePrinter << "  complexity" << ColumnBreak()
+                     << Benchmark::complexityName( fit->complexity )
+                     << ColumnBreak() << Duration( fit->coefficient )
+                     << ColumnBreak() << rss.str() << ColumnBreak();
+    }
+} // end anon namespace
+
 ConsoleReporter::ConsoleReporter(ReporterConfig&& config):
     StreamingReporterBase( CATCH_MOVE( config ) ),
     m_tablePrinter(Detail::make_unique<TablePrinter>(m_stream,
@@ -550,19 +771,32 @@ void ConsoleReporter::benchmarkPreparing( StringRef name ) {
 	}
 }
 
-void ConsoleReporter::benchmarkStarting(BenchmarkInfo const& info) {
-    (*m_tablePrinter) << info.samples << ColumnBreak()
-        << info.iterations << ColumnBreak();
-    if ( !m_config->benchmarkNoAnalysis() ) {
-        ( *m_tablePrinter )
-            << Duration( info.estimatedDuration ) << ColumnBreak();
-    }
+void ConsoleReporter::benchmarkStarting(BenchmarkInfo const&) {
+    // The sample count is only known at the end, because sampling can
+    // stop early at the target precision
     ( *m_tablePrinter ) << OutputFlush{};
 }
 void ConsoleReporter::benchmarkEnded(BenchmarkStats<> const& stats) {
+    (*m_tablePrinter) << stats.info.samples << ColumnBreak()
+        << stats.info.iterations << ColumnBreak();
+    if ( !m_config->benchmarkNoAnalysis() ) {
+        ( *m_tablePrinter )
+            << Duration( stats.info.estimatedDuration ) << ColumnBreak();
+    }
     if (m_config->benchmarkNoAnalysis())
     {
         (*m_tablePrinter) << Duration(stats.mean.point.count()) << ColumnBreak();
+        printColdCache(*m_tablePrinter, stats.info.coldCache);
+        printFrequencyDrift(*m_tablePrinter, stats.frequencyDrift);
+        printScalingEfficiency(*m_tablePrinter, stats.scalingEfficiency);
+        printComplexity(*m_tablePrinter, stats.complexity);
+        printBaselineComparison(*m_tablePrinter, stats.baselineRatio);
+        printBenchmarkCounters(*m_tablePrinter, stats.counters);
+        printThroughput(*m_tablePrinter, stats.bytesPerSecond, stats.itemsPerSecond);
+        printUserCounters(*m_tablePrinter, stats.userCounters);
+        printPercentiles(*m_tablePrinter, stats.percentiles, false);
+        printIterationTimes(*m_tablePrinter, stats.maxIteration, stats.iterationJitter);
+        printHistogram(*m_tablePrinter, stats.histogram);
     }
     else
     {
@@ -572,7 +806,19 @@ void ConsoleReporter::benchmarkEnded(BenchmarkStats<> const& stats) {
             << Duration(stats.mean.upper_bound.count()) << ColumnBreak() << ColumnBreak()
             << Duration(stats.standardDeviation.point.count()) << ColumnBreak()
             << Duration(stats.standardDeviation.lower_bound.count()) << ColumnBreak()
-            << Duration(stats.standardDeviation.upper_bound.count()) << ColumnBreak() << ColumnBreak() << ColumnBreak() << ColumnBreak() << ColumnBreak();
+            << Duration(stats.standardDeviation.upper_bound.count()) << ColumnBreak();
+        printColdCache(*m_tablePrinter, stats.info.coldCache);
+        printFrequencyDrift(*m_tablePrinter, stats.frequencyDrift);
+        printScalingEfficiency(*m_tablePrinter, stats.scalingEfficiency);
+        printComplexity(*m_tablePrinter, stats.complexity);
+        printBaselineComparison(*m_tablePrinter, stats.baselineRatio);
+        printBenchmarkCounters(*m_tablePrinter, stats.counters);
+        printThroughput(*m_tablePrinter, stats.bytesPerSecond, stats.itemsPerSecond);
+        printUserCounters(*m_tablePrinter, stats.userCounters);
+        printPercentiles(*m_tablePrinter, stats.percentiles, true);
+        printIterationTimes(*m_tablePrinter, stats.maxIteration, stats.iterationJitter);
+        printHistogram(*m_tablePrinter, stats.histogram);
+        (*m_tablePrinter) << ColumnBreak() << ColumnBreak() << ColumnBreak() << ColumnBreak();
     }
 }
 
@@ -588,9 +834,16 @@ void ConsoleReporter::testCaseEnded(TestCaseStats const& _testCaseStats) {
     StreamingReporterBase::testCaseEnded(_testCaseStats);
     m_headerPrinted = false;
 }
+void ConsoleReporter::testCaseCached(TestCaseInfo const&) {
+    ++m_cachedTestCases;
+}
 void ConsoleReporter::testRunEnded(TestRunStats const& _testRunStats) {
     printTotalsDivider(_testRunStats.totals);
     printTestRunTotals( m_stream, *m_colour, _testRunStats.totals );
+    if ( m_cachedTestCases > 0 ) {
+        m_stream << pluralise( m_cachedTestCases, "test case"_sr )
+                 << " passed previously with the same build and did not run\n";
+    }
     m_stream << '\n' << std::flush;
     StreamingReporterBase::testRunEnded(_testRunStats);
 }
@@ -600,8 +853,32 @@ void ConsoleReporter::testRunStarting(TestRunInfo const& _testRunInfo) {
         m_stream << m_colour->guardColour( Colour::BrightYellow ) << "Filters: "
                  << m_config->testSpec() << '\n';
     }
-    m_stream << "Randomness seeded to: " << getSeed() << '\n'
-             << std::flush;
+    m_stream << "Randomness seeded to: " << getSeed() << '\n';
+    if ( m_config->benchmarkCpu() >= 0 && !m_config->skipBenchmarks() ) {
+        const auto cpu = Benchmark::Detail::readCpuState(
+            m_config->benchmarkCpu(), true );
+        m_stream << "Benchmarks pinned to CPU " << cpu.cpu << ": "
+                 << Benchmark::Detail::describeCpuState( cpu );
+        if ( cpu.frequency > 0. ) {
+            m_stream << " at " << cpu.frequency << " MHz";
+        }
+        m_stream << '\n';
+    }
+    if ( m_config->benchmarkClock() == BenchmarkClock::Tsc &&
+         !m_config->skipBenchmarks() ) {
+        if ( Benchmark::Detail::tsc_clock::is_available() ) {
+            ReusableStringStream rss;
+            rss << std::fixed << std::setprecision( 3 )
+                << 1. / Benchmark::Detail::tscNanosecondsPerTick;
+            m_stream << "Benchmarks timed with the TSC at " << rss.str()
+                     << " GHz\n";
+        } else {
+            m_stream << m_colour->guardColour( Colour::BrightYellow )
+                     << "No invariant TSC on this CPU, benchmarks timed with steady_clock"
+                     << '\n';
+        }
+    }
+    m_stream << std::flush;
 }
 
 void ConsoleReporter::lazyPrint() {
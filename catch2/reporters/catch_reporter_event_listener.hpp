@@ -52,6 +52,7 @@ namespace Catch {
         void testCaseEnded( TestCaseStats const& testCaseStats ) override;
         void testRunEnded( TestRunStats const& testRunStats ) override;
         void skipTest( TestCaseInfo const& testInfo ) override;
+        void testCaseCached( TestCaseInfo const& testInfo ) override;
     };
 
 } // end namespace Catch
@@ -102,6 +103,7 @@ namespace Catch {
     void EventListenerBase::testCaseEnded( TestCaseStats const& ) {}
     void EventListenerBase::testRunEnded( TestRunStats const& ) {}
     void EventListenerBase::skipTest( TestCaseInfo const& ) {}
+    void EventListenerBase::testCaseCached( TestCaseInfo const& ) {}
 } // namespace Catch
 #endif // CATCH2_IMPLEMENTATION
 #endif // CATCH_REPORTER_EVENT_LISTENER_CPP_INCLUDED
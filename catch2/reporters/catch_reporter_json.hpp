@@ -29,6 +29,7 @@ namespace Catch {
 
         void testCaseStarting( TestCaseInfo const& tcInfo ) override;
         void testCaseEnded( TestCaseStats const& tcStats ) override;
+        void testCaseCached( TestCaseInfo const& tcInfo ) override;
 
         void testCasePartialStarting( TestCaseInfo const& tcInfo,
                                       uint64_t index ) override;
@@ -84,6 +85,9 @@ namespace Catch {
         std::stack<Writer> m_writers{};
 
         bool m_startedListing = false;
+        std::uint64_t m_cachedTestCases = 0;
+        //! Name of the benchmark being run, for reporting its failure
+        std::string m_benchmarkName;
 
         // std::size_t m_sectionDepth = 0;
         // std::size_t m_sectionStarted = 0;
@@ -106,6 +110,9 @@ namespace Catch {
 // SPDX-License-Identifier: BSL-1.0
 //
 #include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_benchmark_stats.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_test_spec.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_version.hpp"  // Adjust to relative path (@wolfram77)
 #include "../interfaces/catch_interfaces_config.hpp"  // Adjust to relative path (@wolfram77)
@@ -124,6 +131,23 @@ namespace Catch {
             source_location_writer.write( "line"_sr ).write( sourceInfo.line );
         }
 
+        void writeEstimate( JsonObjectWriter&& writer,
+                            Benchmark::Estimate<double> const& estimate ) {
+            writer.write( "value"_sr ).write( estimate.point );
+            writer.write( "lower-bound"_sr ).write( estimate.lower_bound );
+            writer.write( "upper-bound"_sr ).write( estimate.upper_bound );
+            writer.write( "ci"_sr ).write( estimate.confidence_interval );
+        }
+
+        void writeEstimate( JsonObjectWriter&& writer,
+                            Benchmark::Estimate<Benchmark::FDuration> const& estimate ) {
+            writeEstimate( CATCH_MOVE( writer ),
+                           Benchmark::Estimate<double>{ estimate.point.count(),
+                                                        estimate.lower_bound.count(),
+                                                        estimate.upper_bound.count(),
+                                                        estimate.confidence_interval } );
+        }
+
         void writeTags( JsonArrayWriter writer, std::vector<Tag> const& tags ) {
             for ( auto const& tag : tags ) {
                 writer.write( tag.original );
@@ -243,12 +267,15 @@ namespace Catch {
         startArray( "test-cases"_sr );
     }
 
-     static void writeCounts( JsonObjectWriter&& writer, Counts const& counts ) {
+     static void writeCounts( JsonObjectWriter& writer, Counts const& counts ) {
         writer.write( "passed"_sr ).write( counts.passed );
         writer.write( "failed"_sr ).write( counts.failed );
         writer.write( "fail-but-ok"_sr ).write( counts.failedButOk );
         writer.write( "skipped"_sr ).write( counts.skipped );
     }
+     static void writeCounts( JsonObjectWriter&& writer, Counts const& counts ) {
+        writeCounts( writer, counts );
+    }
 
     void JsonReporter::testRunEnded(TestRunStats const& runStats) {
         assert( isInside( Writer::Array ) );
@@ -260,8 +287,9 @@ namespace Catch {
                 m_objectWriters.top().write( "totals"_sr ).writeObject();
             writeCounts( totals.write( "assertions"_sr ).writeObject(),
                          runStats.totals.assertions );
-            writeCounts( totals.write( "test-cases"_sr ).writeObject(),
-                         runStats.totals.testCases );
+            auto testCases = totals.write( "test-cases"_sr ).writeObject();
+            writeCounts( testCases, runStats.totals.testCases );
+            testCases.write( "cached"_sr ).write( m_cachedTestCases );
         }
 
         // End the "test-run" object
@@ -315,6 +343,30 @@ namespace Catch {
         endObject();
     }
 
+    void JsonReporter::testCaseCached( TestCaseInfo const& tcInfo ) {
+        ++m_cachedTestCases;
+
+        assert( isInside( Writer::Array ) &&
+                "We should be in the 'test-cases' array" );
+        auto testCase = m_arrayWriters.top().writeObject();
+        {
+            auto testInfo = testCase.write( "test-info"_sr ).writeObject();
+            testInfo.write( "name"_sr ).write( tcInfo.name );
+            writeSourceInfo( testInfo, tcInfo.lineInfo );
+            writeTags( testInfo.write( "tags"_sr ).writeArray(), tcInfo.tags );
+            writeProperties( testInfo.write( "properties"_sr ).writeArray(),
+                             tcInfo );
+        }
+        // The test case passed in an earlier run and did not run now
+        testCase.write( "cached"_sr ).write( true );
+        testCase.write( "runs"_sr ).writeArray();
+        {
+            auto totals = testCase.write( "totals"_sr ).writeObject();
+            writeCounts( totals.write( "assertions"_sr ).writeObject(),
+                         Counts{} );
+        }
+    }
+
     void JsonReporter::testCasePartialStarting( TestCaseInfo const& /*tcInfo*/,
                                                 uint64_t index ) {
         startObject();
@@ -403,10 +455,145 @@ namespace Catch {
     }
 
 
-    void JsonReporter::benchmarkPreparing( StringRef name ) { (void)name; }
+    void JsonReporter::benchmarkPreparing( StringRef name ) {
+        m_benchmarkName = static_cast<std::string>( name );
+    }
     void JsonReporter::benchmarkStarting( BenchmarkInfo const& ) {}
-    void JsonReporter::benchmarkEnded( BenchmarkStats<> const& ) {}
-    void JsonReporter::benchmarkFailed( StringRef error ) { (void)error; }
+
+    void JsonReporter::benchmarkEnded( BenchmarkStats<> const& benchmarkStats ) {
+        assert( isInside( Writer::Array ) );
+        auto benchmarkObject = m_arrayWriters.top().writeObject();
+
+        auto const& info = benchmarkStats.info;
+        benchmarkObject.write( "kind"_sr ).write( "benchmark"_sr );
+        benchmarkObject.write( "name"_sr ).write( info.name );
+        if ( !info.family.empty() ) {
+            benchmarkObject.write( "family"_sr ).write( info.family );
+            benchmarkObject.write( info.parameter ).write( info.parameterValue );
+        }
+        if ( info.coldCache ) {
+            benchmarkObject.write( "cold-cache"_sr ).write( true );
+        }
+        {
+            auto cpu = benchmarkObject.write( "cpu"_sr ).writeObject();
+            if ( info.cpu.cpu >= 0 ) {
+                cpu.write( "id"_sr ).write( info.cpu.cpu );
+                cpu.write( "pinned"_sr ).write( info.cpu.pinned );
+            }
+            if ( !info.cpu.model.empty() ) {
+                cpu.write( "model"_sr ).write( info.cpu.model );
+            }
+            if ( !info.cpu.governor.empty() ) {
+                cpu.write( "governor"_sr ).write( info.cpu.governor );
+            }
+            if ( info.cpu.frequency > 0. ) {
+                cpu.write( "frequency-mhz"_sr ).write( info.cpu.frequency );
+            }
+            cpu.write( "turbo"_sr ).write( turboBoostName( info.cpu.turbo ) );
+        }
+        benchmarkObject.write( "samples"_sr ).write( info.samples );
+        benchmarkObject.write( "resamples"_sr ).write( info.resamples );
+        benchmarkObject.write( "iterations"_sr ).write( info.iterations );
+        // All durations are in nanoseconds
+        benchmarkObject.write( "clock-resolution"_sr ).write( info.clockResolution );
+        benchmarkObject.write( "estimated-duration"_sr ).write( info.estimatedDuration );
+        writeEstimate( benchmarkObject.write( "mean"_sr ).writeObject(),
+                       benchmarkStats.mean );
+        writeEstimate( benchmarkObject.write( "standard-deviation"_sr ).writeObject(),
+                       benchmarkStats.standardDeviation );
+        {
+            auto outliers = benchmarkObject.write( "outliers"_sr ).writeObject();
+            auto const& counts = benchmarkStats.outliers;
+            outliers.write( "variance"_sr ).write( benchmarkStats.outlierVariance );
+            outliers.write( "low-mild"_sr ).write( counts.low_mild );
+            outliers.write( "low-severe"_sr ).write( counts.low_severe );
+            outliers.write( "high-mild"_sr ).write( counts.high_mild );
+            outliers.write( "high-severe"_sr ).write( counts.high_severe );
+        }
+        if ( benchmarkStats.scalingEfficiency ) {
+            benchmarkObject.write( "scaling-efficiency"_sr )
+                .write( *benchmarkStats.scalingEfficiency );
+        }
+        if ( benchmarkStats.complexity ) {
+            auto complexity = benchmarkObject.write( "complexity"_sr ).writeObject();
+            complexity.write( "big-o"_sr ).write(
+                Benchmark::complexityName( benchmarkStats.complexity->complexity ) );
+            complexity.write( "coefficient"_sr ).write( benchmarkStats.complexity->coefficient );
+            complexity.write( "rms"_sr ).write( benchmarkStats.complexity->rms );
+        }
+        if ( !benchmarkStats.percentiles.empty() ) {
+            auto percentiles = benchmarkObject.write( "percentiles"_sr ).writeArray();
+            for ( auto const& percentile : benchmarkStats.percentiles ) {
+                auto percentileObject = percentiles.writeObject();
+                percentileObject.write( "percentile"_sr ).write( percentile.percentile );
+                writeEstimate( CATCH_MOVE( percentileObject ), percentile.value );
+            }
+        }
+        if ( benchmarkStats.maxIteration || benchmarkStats.iterationJitter ) {
+            // In nanoseconds, like the estimates
+            auto iterations = benchmarkObject.write( "iterations"_sr ).writeObject();
+            if ( benchmarkStats.maxIteration ) {
+                iterations.write( "max"_sr ).write( benchmarkStats.maxIteration->count() );
+            }
+            if ( benchmarkStats.iterationJitter ) {
+                iterations.write( "jitter"_sr ).write( benchmarkStats.iterationJitter->count() );
+            }
+        }
+        if ( !benchmarkStats.histogram.empty() ) {
+            // Only the non-empty buckets, bounds in nanoseconds
+            auto histogram = benchmarkObject.write( "histogram"_sr ).writeArray();
+            for ( auto const& bucket : benchmarkStats.histogram ) {
+                auto bucketObject = histogram.writeObject();
+                bucketObject.write( "lower-bound"_sr ).write( bucket.lowerBound );
+                bucketObject.write( "upper-bound"_sr ).write( bucket.upperBound );
+                bucketObject.write( "count"_sr ).write( bucket.count );
+            }
+        }
+        if ( benchmarkStats.bytesPerSecond || benchmarkStats.itemsPerSecond ) {
+            auto throughput = benchmarkObject.write( "throughput"_sr ).writeObject();
+            if ( benchmarkStats.bytesPerSecond ) {
+                throughput.write( "bytes-per-second"_sr ).write( *benchmarkStats.bytesPerSecond );
+            }
+            if ( benchmarkStats.itemsPerSecond ) {
+                throughput.write( "items-per-second"_sr ).write( *benchmarkStats.itemsPerSecond );
+            }
+        }
+        if ( !benchmarkStats.userCounters.empty() ) {
+            auto counters = benchmarkObject.write( "user-counters"_sr ).writeObject();
+            for ( auto const& counter : benchmarkStats.userCounters ) {
+                auto counterObject = counters.write( counter.name ).writeObject();
+                counterObject.write( "mode"_sr ).write( Benchmark::counterModeName( counter.mode ) );
+                counterObject.write( "value"_sr ).write( counter.value );
+            }
+        }
+        if ( benchmarkStats.frequencyDrift ) {
+            benchmarkObject.write( "frequency-drift"_sr )
+                .write( *benchmarkStats.frequencyDrift );
+        }
+        if ( benchmarkStats.baselineRatio ) {
+            auto ratio = benchmarkObject.write( "baseline-ratio"_sr ).writeObject();
+            ratio.write( "baseline"_sr ).write( m_config->benchmarkCompareBaseline() );
+            ratio.write( "value"_sr ).write( benchmarkStats.baselineRatio->point );
+            ratio.write( "lower-bound"_sr ).write( benchmarkStats.baselineRatio->lower_bound );
+            ratio.write( "upper-bound"_sr ).write( benchmarkStats.baselineRatio->upper_bound );
+            ratio.write( "ci"_sr ).write( benchmarkStats.baselineRatio->confidence_interval );
+        }
+        {
+            // Counter values are per iteration
+            auto counters = benchmarkObject.write( "counters"_sr ).writeObject();
+            for ( auto const& counter : benchmarkStats.counters ) {
+                counters.write( counter.name ).write( counter.value );
+            }
+        }
+    }
+
+    void JsonReporter::benchmarkFailed( StringRef error ) {
+        assert( isInside( Writer::Array ) );
+        auto benchmarkObject = m_arrayWriters.top().writeObject();
+        benchmarkObject.write( "kind"_sr ).write( "benchmark"_sr );
+        benchmarkObject.write( "name"_sr ).write( m_benchmarkName );
+        benchmarkObject.write( "failed"_sr ).write( error );
+    }
 
     void JsonReporter::listReporters(
         std::vector<ReporterDescription> const& descriptions ) {
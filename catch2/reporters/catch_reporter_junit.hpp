@@ -27,12 +27,16 @@ namespace Catch {
 
         void testCaseEnded(TestCaseStats const& testCaseStats) override;
 
+        void testCaseCached(TestCaseInfo const& testInfo) override;
+
         void testRunEndedCumulative() override;
 
     private:
         void writeRun(TestRunNode const& testRunNode, double suiteTime);
 
         void writeTestCase(TestCaseNode const& testCaseNode);
+        void writeCachedTestCase(TestCaseInfo const& testInfo);
+        std::string testCaseClassName(TestCaseInfo const& testInfo) const;
 
         void writeSection( std::string const& className,
                            std::string const& rootName,
@@ -48,6 +52,8 @@ namespace Catch {
         std::string stdErrForSuite;
         unsigned int unexpectedExceptions = 0;
         bool m_okToFail = false;
+        //! Written out as skipped, they did not run
+        std::vector<TestCaseInfo const*> m_cachedTestCases;
     };
 
 } // end namespace Catch
@@ -165,6 +171,7 @@ namespace Catch {
         stdOutForSuite.clear();
         stdErrForSuite.clear();
         unexpectedExceptions = 0;
+        m_cachedTestCases.clear();
     }
 
     void JunitReporter::testCaseStarting( TestCaseInfo const& testCaseInfo ) {
@@ -183,6 +190,10 @@ namespace Catch {
         CumulativeReporterBase::testCaseEnded( testCaseStats );
     }
 
+    void JunitReporter::testCaseCached( TestCaseInfo const& testInfo ) {
+        m_cachedTestCases.push_back( &testInfo );
+    }
+
     void JunitReporter::testRunEndedCumulative() {
         const auto suiteTime = suiteTimer.getElapsedSeconds();
         writeRun( *m_testRun, suiteTime );
@@ -193,11 +204,12 @@ namespace Catch {
         XmlWriter::ScopedElement e = xml.scopedElement( "testsuite" );
 
         TestRunStats const& stats = testRunNode.value;
+        const auto cached = static_cast<std::uint64_t>( m_cachedTestCases.size() );
         xml.writeAttribute( "name"_sr, stats.runInfo.name );
         xml.writeAttribute( "errors"_sr, unexpectedExceptions );
         xml.writeAttribute( "failures"_sr, stats.totals.assertions.failed-unexpectedExceptions );
-        xml.writeAttribute( "skipped"_sr, stats.totals.assertions.skipped );
-        xml.writeAttribute( "tests"_sr, stats.totals.assertions.total() );
+        xml.writeAttribute( "skipped"_sr, stats.totals.assertions.skipped + cached );
+        xml.writeAttribute( "tests"_sr, stats.totals.assertions.total() + cached );
         xml.writeAttribute( "hostname"_sr, "tbd"_sr ); // !TBD
         if( m_config->showDurations() == ShowDurations::Never )
             xml.writeAttribute( "time"_sr, ""_sr );
@@ -221,6 +233,8 @@ namespace Catch {
         // Write test cases
         for( auto const& child : testRunNode.children )
             writeTestCase( *child );
+        for( auto const* testInfo : m_cachedTestCases )
+            writeCachedTestCase( *testInfo );
 
         xml.scopedElement( "system-out" ).writeText( trim( stdOutForSuite ), XmlFormatting::Newline );
         xml.scopedElement( "system-err" ).writeText( trim( stdErrForSuite ), XmlFormatting::Newline );
@@ -234,11 +248,24 @@ namespace Catch {
         assert( testCaseNode.children.size() == 1 );
         SectionNode const& rootSection = *testCaseNode.children.front();
 
-        std::string className =
-            static_cast<std::string>( stats.testInfo->className );
+        writeSection( testCaseClassName( *stats.testInfo ), "", rootSection, stats.testInfo->okToFail() );
+    }
+
+    void JunitReporter::writeCachedTestCase( TestCaseInfo const& testInfo ) {
+        XmlWriter::ScopedElement e = xml.scopedElement( "testcase" );
+        xml.writeAttribute( "classname"_sr, testCaseClassName( testInfo ) );
+        xml.writeAttribute( "name"_sr, trim( StringRef( testInfo.name ) ) );
+        xml.writeAttribute( "time"_sr, formatDuration( 0 ) );
+        xml.writeAttribute( "status"_sr, "notrun"_sr );
+        xml.scopedElement( "skipped" )
+            .writeAttribute( "message"_sr, "passed previously with the same build"_sr );
+    }
+
+    std::string JunitReporter::testCaseClassName( TestCaseInfo const& testInfo ) const {
+        std::string className = static_cast<std::string>( testInfo.className );
 
         if( className.empty() ) {
-            className = fileNameTag(stats.testInfo->tags);
+            className = fileNameTag(testInfo.tags);
             if ( className.empty() ) {
                 className = "global";
             }
@@ -248,8 +275,7 @@ namespace Catch {
             className = static_cast<std::string>(m_config->name()) + '.' + className;
 
         normalizeNamespaceMarkers(className);
-
-        writeSection( className, "", rootSection, stats.testInfo->okToFail() );
+        return className;
     }
 
     void JunitReporter::writeSection( std::string const& className,
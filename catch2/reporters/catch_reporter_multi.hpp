@@ -62,6 +62,7 @@ namespace Catch {
         void testRunEnded( TestRunStats const& testRunStats ) override;
 
         void skipTest( TestCaseInfo const& testInfo ) override;
+        void testCaseCached( TestCaseInfo const& testInfo ) override;
 
         void listReporters(std::vector<ReporterDescription> const& descriptions) override;
         void listListeners(std::vector<ListenerDescription> const& descriptions) override;
@@ -253,6 +254,12 @@ namespace Catch {
         }
     }
 
+    void MultiReporter::testCaseCached( TestCaseInfo const& testInfo ) {
+        for ( auto& reporterish : m_reporterLikes ) {
+            reporterish->testCaseCached( testInfo );
+        }
+    }
+
     void MultiReporter::listReporters(std::vector<ReporterDescription> const& descriptions) {
         for (auto& reporterish : m_reporterLikes) {
             reporterish->listReporters(descriptions);
@@ -31,10 +31,13 @@ namespace Catch {
 
         void assertionEnded(AssertionStats const& _assertionStats) override;
 
+        void testCaseCached(TestCaseInfo const& testInfo) override;
+
         void testRunEnded(TestRunStats const& _testRunStats) override;
 
     private:
         std::size_t counter = 0;
+        std::uint64_t m_cachedTestCases = 0;
     };
 
 } // end namespace Catch
@@ -262,9 +265,20 @@ namespace Catch {
         m_stream << '\n' << std::flush;
     }
 
+    void TAPReporter::testCaseCached(TestCaseInfo const& testInfo) {
+        ++counter;
+        ++m_cachedTestCases;
+
+        m_stream << "# " << testInfo.name << '\n'
+                 << "ok " << counter
+                 << " - # SKIP passed previously with the same build\n\n"
+                 << std::flush;
+    }
+
     void TAPReporter::testRunEnded(TestRunStats const& _testRunStats) {
-        m_stream << "1.." << _testRunStats.totals.assertions.total();
-        if (_testRunStats.totals.testCases.total() == 0) {
+        // Every cached test case was reported as one skipped test point
+        m_stream << "1.." << _testRunStats.totals.assertions.total() + m_cachedTestCases;
+        if (_testRunStats.totals.testCases.total() == 0 && m_cachedTestCases == 0) {
             m_stream << " # Skipped: No tests ran.";
         }
         m_stream << "\n\n" << std::flush;
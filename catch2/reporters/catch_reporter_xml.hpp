@@ -11,6 +11,7 @@
 
 #include "../internal/catch_xmlwriter.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_timer.hpp"  // Adjust to relative path (@wolfram77)
+#include "../internal/catch_optional.hpp"  // Adjust to relative path (@wolfram77)
 
 
 namespace Catch {
@@ -26,6 +27,8 @@ namespace Catch {
 
         void writeSourceInfo(SourceLineInfo const& sourceInfo);
 
+        void writeBenchmarkInfo(BenchmarkInfo const& info);
+
     public: // StreamingReporterBase
 
         void testRunStarting(TestRunInfo const& testInfo) override;
@@ -40,6 +43,8 @@ namespace Catch {
 
         void testCaseEnded(TestCaseStats const& testCaseStats) override;
 
+        void testCaseCached(TestCaseInfo const& testInfo) override;
+
         void testRunEnded(TestRunStats const& testRunStats) override;
 
         void benchmarkPreparing( StringRef name ) override;
@@ -56,6 +61,9 @@ namespace Catch {
         Timer m_testCaseTimer;
         XmlWriter m_xml;
         int m_sectionDepth = 0;
+        std::uint64_t m_cachedTestCases = 0;
+        //! Written out when the benchmark ends, with the samples it took
+        Optional<BenchmarkInfo> m_benchmarkInfo;
     };
 
 } // end namespace Catch
@@ -84,6 +92,8 @@ namespace Catch {
 #include "../catch_test_case_info.hpp"  // Adjust to relative path (@wolfram77)
 #include "../internal/catch_move_and_forward.hpp"  // Adjust to relative path (@wolfram77)
 #include "../catch_version.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_cpu_state.hpp"  // Adjust to relative path (@wolfram77)
+#include "../benchmark/detail/catch_user_counters.hpp"  // Adjust to relative path (@wolfram77)
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -272,6 +282,19 @@ namespace Catch {
         m_xml.endElement();
     }
 
+    void XmlReporter::testCaseCached( TestCaseInfo const& testInfo ) {
+        ++m_cachedTestCases;
+        m_xml.startElement( "TestCase" )
+            .writeAttribute( "name"_sr, trim( StringRef(testInfo.name) ) )
+            .writeAttribute( "tags"_sr, testInfo.tagsAsString() );
+        writeSourceInfo( testInfo.lineInfo );
+        m_xml.writeAttribute( "cached"_sr, true );
+        m_xml.scopedElement( "OverallResult" )
+            .writeAttribute( "success"_sr, true )
+            .writeAttribute( "skips"_sr, 0 );
+        m_xml.endElement();
+    }
+
     void XmlReporter::testRunEnded( TestRunStats const& testRunStats ) {
         StreamingReporterBase::testRunEnded( testRunStats );
         m_xml.scopedElement( "OverallResults" )
@@ -283,7 +306,8 @@ namespace Catch {
             .writeAttribute( "successes"_sr, testRunStats.totals.testCases.passed )
             .writeAttribute( "failures"_sr, testRunStats.totals.testCases.failed )
             .writeAttribute( "expectedFailures"_sr, testRunStats.totals.testCases.failedButOk )
-            .writeAttribute( "skips"_sr, testRunStats.totals.testCases.skipped );
+            .writeAttribute( "skips"_sr, testRunStats.totals.testCases.skipped )
+            .writeAttribute( "cached"_sr, m_cachedTestCases );
         m_xml.endElement();
     }
 
@@ -293,15 +317,45 @@ namespace Catch {
     }
 
     void XmlReporter::benchmarkStarting(BenchmarkInfo const &info) {
+        m_benchmarkInfo = info;
+    }
+
+    void XmlReporter::writeBenchmarkInfo(BenchmarkInfo const& info) {
         m_xml.writeAttribute("samples"_sr, info.samples)
             .writeAttribute("resamples"_sr, info.resamples)
             .writeAttribute("iterations"_sr, info.iterations)
             .writeAttribute("clockResolution"_sr, info.clockResolution)
-            .writeAttribute("estimatedDuration"_sr, info.estimatedDuration)
-            .writeComment("All values in nano seconds"_sr);
+            .writeAttribute("estimatedDuration"_sr, info.estimatedDuration);
+        if (!info.family.empty()) {
+            m_xml.writeAttribute("family"_sr, info.family)
+                .writeAttribute(info.parameter, info.parameterValue);
+        }
+        if (info.coldCache) {
+            m_xml.writeAttribute("coldCache"_sr, true);
+        }
+        m_xml.writeComment("All values in nano seconds"_sr);
+        {
+            auto cpu = m_xml.scopedElement("cpu");
+            if (info.cpu.cpu >= 0) {
+                cpu.writeAttribute("id"_sr, info.cpu.cpu)
+                    .writeAttribute("pinned"_sr, info.cpu.pinned);
+            }
+            if (!info.cpu.model.empty()) {
+                cpu.writeAttribute("model"_sr, info.cpu.model);
+            }
+            if (!info.cpu.governor.empty()) {
+                cpu.writeAttribute("governor"_sr, info.cpu.governor);
+            }
+            if (info.cpu.frequency > 0.) {
+                cpu.writeAttribute("frequencyMHz"_sr, info.cpu.frequency);
+            }
+            cpu.writeAttribute("turbo"_sr, turboBoostName(info.cpu.turbo));
+        }
     }
 
     void XmlReporter::benchmarkEnded(BenchmarkStats<> const& benchmarkStats) {
+        m_benchmarkInfo.reset();
+        writeBenchmarkInfo(benchmarkStats.info);
         m_xml.scopedElement("mean")
             .writeAttribute("value"_sr, benchmarkStats.mean.point.count())
             .writeAttribute("lowerBound"_sr, benchmarkStats.mean.lower_bound.count())
@@ -318,10 +372,83 @@ namespace Catch {
             .writeAttribute("lowSevere"_sr, benchmarkStats.outliers.low_severe)
             .writeAttribute("highMild"_sr, benchmarkStats.outliers.high_mild)
             .writeAttribute("highSevere"_sr, benchmarkStats.outliers.high_severe);
+        if (benchmarkStats.scalingEfficiency) {
+            m_xml.scopedElement("scalingEfficiency")
+                .writeAttribute("value"_sr, *benchmarkStats.scalingEfficiency);
+        }
+        if (benchmarkStats.complexity) {
+            m_xml.scopedElement("complexity")
+                .writeAttribute("bigO"_sr, Benchmark::complexityName(benchmarkStats.complexity->complexity))
+                .writeAttribute("coefficient"_sr, benchmarkStats.complexity->coefficient)
+                .writeAttribute("rms"_sr, benchmarkStats.complexity->rms);
+        }
+        if (benchmarkStats.bytesPerSecond || benchmarkStats.itemsPerSecond) {
+            auto throughput = m_xml.scopedElement("throughput");
+            if (benchmarkStats.bytesPerSecond) {
+                throughput.writeAttribute("bytesPerSecond"_sr, *benchmarkStats.bytesPerSecond);
+            }
+            if (benchmarkStats.itemsPerSecond) {
+                throughput.writeAttribute("itemsPerSecond"_sr, *benchmarkStats.itemsPerSecond);
+            }
+        }
+        for (auto const& percentile : benchmarkStats.percentiles) {
+            m_xml.scopedElement("percentile")
+                .writeAttribute("percentile"_sr, percentile.percentile)
+                .writeAttribute("value"_sr, percentile.value.point.count())
+                .writeAttribute("lowerBound"_sr, percentile.value.lower_bound.count())
+                .writeAttribute("upperBound"_sr, percentile.value.upper_bound.count())
+                .writeAttribute("ci"_sr, percentile.value.confidence_interval);
+        }
+        if (benchmarkStats.maxIteration || benchmarkStats.iterationJitter) {
+            auto iterations = m_xml.scopedElement("iterations");
+            if (benchmarkStats.maxIteration) {
+                iterations.writeAttribute("max"_sr, benchmarkStats.maxIteration->count());
+            }
+            if (benchmarkStats.iterationJitter) {
+                iterations.writeAttribute("jitter"_sr, benchmarkStats.iterationJitter->count());
+            }
+        }
+        if (!benchmarkStats.histogram.empty()) {
+            auto histogram = m_xml.scopedElement("histogram");
+            for (auto const& bucket : benchmarkStats.histogram) {
+                m_xml.scopedElement("bucket")
+                    .writeAttribute("lowerBound"_sr, bucket.lowerBound)
+                    .writeAttribute("upperBound"_sr, bucket.upperBound)
+                    .writeAttribute("count"_sr, bucket.count);
+            }
+        }
+        for (auto const& counter : benchmarkStats.userCounters) {
+            m_xml.scopedElement("userCounter")
+                .writeAttribute("name"_sr, counter.name)
+                .writeAttribute("mode"_sr, Benchmark::counterModeName(counter.mode))
+                .writeAttribute("value"_sr, counter.value);
+        }
+        if (benchmarkStats.frequencyDrift) {
+            m_xml.scopedElement("frequencyDrift")
+                .writeAttribute("value"_sr, *benchmarkStats.frequencyDrift);
+        }
+        if (benchmarkStats.baselineRatio) {
+            auto const& ratio = *benchmarkStats.baselineRatio;
+            m_xml.scopedElement("baselineRatio")
+                .writeAttribute("baseline"_sr, m_config->benchmarkCompareBaseline())
+                .writeAttribute("value"_sr, ratio.point)
+                .writeAttribute("lowerBound"_sr, ratio.lower_bound)
+                .writeAttribute("upperBound"_sr, ratio.upper_bound)
+                .writeAttribute("ci"_sr, ratio.confidence_interval);
+        }
+        for (auto const& counter : benchmarkStats.counters) {
+            m_xml.scopedElement("counter")
+                .writeAttribute("name"_sr, counter.name)
+                .writeAttribute("perIteration"_sr, counter.value);
+        }
         m_xml.endElement();
     }
 
     void XmlReporter::benchmarkFailed(StringRef error) {
+        if (m_benchmarkInfo) {
+            writeBenchmarkInfo(*m_benchmarkInfo);
+            m_benchmarkInfo.reset();
+        }
         m_xml.scopedElement("failed").
             writeAttribute("message"_sr, error);
         m_xml.endElement();